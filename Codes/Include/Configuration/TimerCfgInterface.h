@@ -1,21 +1,67 @@
-#ifndef _TimerCfgInterface_h_
-#define _TimerCfgInterface_h_
-
-#include "Include/Foundation/SystemInclude.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-
-class TimerCfgInterface
-{
-public:
-    TimerCfgInterface() {};
-    virtual ~TimerCfgInterface() {};
-
-    virtual time_t GetInterval(TableId tableId) const = 0;
-    virtual void SetInterval(TableId tableId, time_t sec) = 0;
-
-    static TimerCfgInterface * CreateInstance();
-};
-
+#ifndef _TimerCfgInterface_h_
+#define _TimerCfgInterface_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+class TimerCfgInterface
+{
+public:
+    TimerCfgInterface() {};
+    virtual ~TimerCfgInterface() {};
+
+    /* version_number of every sub_table is derived from its content, instead of the
+       Version attribute of the xml file.
+     */
+    virtual bool GetAutoVersion() const = 0;
+    /* bitrate budget of a pid for every receiver, in kbps, 0 means no limit. */
+    virtual uint_t GetBitrate(Pid pid) const = 0;
+    /* ts packet number of one udp datagram. */
+    virtual uint_t GetDatagramSize() const = 0;
+    /* repetition tiers of eit schedule sections, {distance in seconds, multiple of the
+       eit schedule interval}, sorted by distance, distance 0 means the rest.
+     */
+    virtual const std::vector<std::pair<time_t, uint_t>>& GetEitTiers() const = 0;
+    /* segment eit schedule across table_id 0x50-0x5F, 0x60-0x6F (ETSI TS 101 211). */
+    virtual bool GetEitSegmentation() const = 0;
+    /* only eit schedule events within the horizon are encoded, in seconds, 0 means no limit. */
+    virtual time_t GetEitHorizon() const = 0;
+    virtual time_t GetInterval(TableId tableId) const = 0;
+    /* max repetition interval target (ETR 211), in seconds. */
+    virtual time_t GetMaxInterval(TableId tableId) const = 0;
+    /* bitrate budget of all si pids for every receiver, in kbps, 0 means no limit. */
+    virtual uint_t GetReceiverBitrate() const = 0;
+    /* sections of the pid are packed in ts packets, a section starts in the ts packet where
+       the previous section ends.
+     */
+    virtual bool GetSectionPacking(Pid pid) const = 0;
+    /* phase stagger of table timers, in percent of the interval. 0: all timers of 
+       same interval fire at same time, 100: first firing is spread over whole interval.
+     */
+    virtual uint_t GetStagger() const = 0;
+    /* tick of the carousel scheduler, in milliseconds. */
+    virtual uint_t GetTick() const = 0;
+    /* coalescing window, in milliseconds. tables of one network which are due within 
+       the window are sent together.
+     */
+    virtual uint_t GetWindow() const = 0;
+    virtual void AddEitTier(time_t distance, uint_t multiple) = 0;
+    virtual void SetAutoVersion(bool enabled) = 0;
+    virtual void SetBitrate(Pid pid, uint_t kbps) = 0;
+    virtual void SetDatagramSize(uint_t packetNumber) = 0;
+    virtual void SetEitSegmentation(bool enabled) = 0;
+    virtual void SetEitHorizon(time_t sec) = 0;
+    virtual void SetInterval(TableId tableId, time_t sec) = 0;
+    virtual void SetMaxInterval(TableId tableId, time_t sec) = 0;
+    virtual void SetReceiverBitrate(uint_t kbps) = 0;
+    virtual void SetSectionPacking(Pid pid, bool enabled) = 0;
+    virtual void SetStagger(uint_t percent) = 0;
+    virtual void SetTick(uint_t msec) = 0;
+    virtual void SetWindow(uint_t msec) = 0;
+
+    static TimerCfgInterface * CreateInstance();
+};
+
 #endif
\ No newline at end of file
@@ -1,86 +1,219 @@
-#ifndef _TimerCfgWrapperInterface_h_
-#define _TimerCfgWrapperInterface_h_
-
-#include "Include/Foundation/SystemInclude.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/Debug.h"
-#include "Include/Foundation/Deleter.h"
-#include "Include/Foundation/XmlHelper.h"
-
-template<typename TimerCfg>
-class TimerCfgWrapperInterface
-{
-public:
-    TimerCfgWrapperInterface() {};
-    virtual ~TimerCfgWrapperInterface() {};
-
-    std::error_code Select(TimerCfg &timerCfg, const char *xmlPath)
-    {
-        if ((ACE_OS::access(xmlPath, F_OK)) != 0)
-        {
-            return  make_error_code(std::errc::no_such_file_or_directory);
-        }
-        
-        shared_ptr<xmlDoc> doc(xmlParseFile(xmlPath), XmlDocDeleter());
-        if (doc == nullptr)
-        {
-            return  make_error_code(std::errc::io_error);
-        }
-
-        xmlNodePtr node = xmlDocGetRootElement(doc.get());
-        shared_ptr<xmlXPathContext> xpathCtx(xmlXPathNewContext(doc.get()), xmlXPathContextDeleter());
-        if (xpathCtx == nullptr)
-        {
-            return  make_error_code(std::errc::io_error);
-        }
-
-        for (node = xmlFirstElementChild(xmlFirstElementChild(node)); 
-             node != nullptr; 
-             node = xmlNextElementSibling(node))
-        {
-            if (xmlStrcmp(node->name, (xmlChar*)"nitactual") == 0)
-            {
-                timerCfg.SetInterval(NitActualTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"nitothers") == 0)
-            {
-                timerCfg.SetInterval(NitOtherTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"sdtactual") == 0)
-            {
-                timerCfg.SetInterval(SdtActualTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"sdtothers") == 0)
-            {
-                timerCfg.SetInterval(SdtOtherTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"bat") == 0)
-            {
-                timerCfg.SetInterval(BatTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"eitactualpf") == 0)
-            {
-                timerCfg.SetInterval(EitActualPfTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"eitotherspf") == 0)
-            {
-                timerCfg.SetInterval(EitOtherPfTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"eitactualsch") == 0)
-            {
-                timerCfg.SetInterval(EitActualSchTableId, GetXmlContent<time_t>(node));
-            }
-            else if (xmlStrcmp(node->name, (xmlChar*)"eitothersch") == 0)
-            {
-                timerCfg.SetInterval(EitOtherSchTableId, GetXmlContent<time_t>(node));
-            }
-        } //for (node = xmlFirstElementChild(xmlFirstElementChild(node));  ...
-
-        xmlCleanupParser();
-        return std::error_code();
-    } 
-};
-
+#ifndef _TimerCfgWrapperInterface_h_
+#define _TimerCfgWrapperInterface_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/Deleter.h"
+#include "Include/Foundation/XmlHelper.h"
+
+template<typename TimerCfg>
+class TimerCfgWrapperInterface
+{
+public:
+    TimerCfgWrapperInterface() {};
+    virtual ~TimerCfgWrapperInterface() {};
+
+    std::error_code Select(TimerCfg &timerCfg, const char *xmlPath)
+    {
+        if ((ACE_OS::access(xmlPath, F_OK)) != 0)
+        {
+            return  make_error_code(std::errc::no_such_file_or_directory);
+        }
+        
+        shared_ptr<xmlDoc> doc(xmlParseFile(xmlPath), XmlDocDeleter());
+        if (doc == nullptr)
+        {
+            return  make_error_code(std::errc::io_error);
+        }
+
+        xmlNodePtr node = xmlDocGetRootElement(doc.get());
+        shared_ptr<xmlXPathContext> xpathCtx(xmlXPathNewContext(doc.get()), xmlXPathContextDeleter());
+        if (xpathCtx == nullptr)
+        {
+            return  make_error_code(std::errc::io_error);
+        }
+
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"table") == 0)
+            {
+                SelectTable(timerCfg, node, &TimerCfg::SetInterval);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"target") == 0)
+            {
+                SelectTable(timerCfg, node, &TimerCfg::SetMaxInterval);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"budget") == 0)
+            {
+                SelectBudget(timerCfg, node);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"packing") == 0)
+            {
+                SelectPacking(timerCfg, node);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eitschedule") == 0)
+            {
+                SelectEitSchedule(timerCfg, node);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"scheduler") == 0)
+            {
+                SelectScheduler(timerCfg, node);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"version") == 0)
+            {
+                SelectVersion(timerCfg, node);
+            }
+        }
+
+        xmlCleanupParser();
+        return std::error_code();
+    } 
+
+private:
+    void SelectBudget(TimerCfg &timerCfg, xmlNodePtr node)
+    {
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"receiver") == 0)
+            {
+                timerCfg.SetReceiverBitrate(GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"nit") == 0)
+            {
+                timerCfg.SetBitrate(NitPid, GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"sdt") == 0)
+            {
+                /* sdt and bat share the same pid. */
+                timerCfg.SetBitrate(SdtPid, GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eit") == 0)
+            {
+                timerCfg.SetBitrate(EitPid, GetXmlContent<uint_t>(node));
+            }
+        }
+    }
+
+    void SelectEitSchedule(TimerCfg &timerCfg, xmlNodePtr node)
+    {
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"tier") == 0)
+            {
+                time_t hours = GetXmlAttrValue<time_t>(node, (const xmlChar*)"hours");
+                timerCfg.AddEitTier(hours * 3600, GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"segmentation") == 0)
+            {
+                timerCfg.SetEitSegmentation(GetXmlContent<uint_t>(node) != 0);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"horizon") == 0)
+            {
+                timerCfg.SetEitHorizon(GetXmlContent<time_t>(node) * 24 * 3600);
+            }
+        }
+    }
+
+    void SelectPacking(TimerCfg &timerCfg, xmlNodePtr node)
+    {
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"nit") == 0)
+            {
+                timerCfg.SetSectionPacking(NitPid, GetXmlContent<uint_t>(node) != 0);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"sdt") == 0)
+            {
+                /* sdt and bat share the same pid. */
+                timerCfg.SetSectionPacking(SdtPid, GetXmlContent<uint_t>(node) != 0);
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eit") == 0)
+            {
+                timerCfg.SetSectionPacking(EitPid, GetXmlContent<uint_t>(node) != 0);
+            }
+        }
+    }
+
+    void SelectVersion(TimerCfg &timerCfg, xmlNodePtr node)
+    {
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"auto") == 0)
+            {
+                timerCfg.SetAutoVersion(GetXmlContent<uint_t>(node) != 0);
+            }
+        }
+    }
+
+    void SelectScheduler(TimerCfg &timerCfg, xmlNodePtr node)
+    {
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"tick") == 0)
+            {
+                timerCfg.SetTick(GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"datagram") == 0)
+            {
+                timerCfg.SetDatagramSize(GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"stagger") == 0)
+            {
+                timerCfg.SetStagger(GetXmlContent<uint_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"window") == 0)
+            {
+                timerCfg.SetWindow(GetXmlContent<uint_t>(node));
+            }
+        }
+    }
+
+    /* <table> and <target> have the same children, setter is SetInterval() or SetMaxInterval() */
+    void SelectTable(TimerCfg &timerCfg, xmlNodePtr node, void (TimerCfg::*setter)(TableId, time_t))
+    {
+        for (node = xmlFirstElementChild(node); node != nullptr; node = xmlNextElementSibling(node))
+        {
+            if (xmlStrcmp(node->name, (xmlChar*)"nitactual") == 0)
+            {
+                (timerCfg.*setter)(NitActualTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"nitothers") == 0)
+            {
+                (timerCfg.*setter)(NitOtherTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"sdtactual") == 0)
+            {
+                (timerCfg.*setter)(SdtActualTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"sdtothers") == 0)
+            {
+                (timerCfg.*setter)(SdtOtherTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"bat") == 0)
+            {
+                (timerCfg.*setter)(BatTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eitactualpf") == 0)
+            {
+                (timerCfg.*setter)(EitActualPfTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eitotherspf") == 0)
+            {
+                (timerCfg.*setter)(EitOtherPfTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eitactualsch") == 0)
+            {
+                (timerCfg.*setter)(EitActualSchTableId, GetXmlContent<time_t>(node));
+            }
+            else if (xmlStrcmp(node->name, (xmlChar*)"eitothersch") == 0)
+            {
+                (timerCfg.*setter)(EitOtherSchTableId, GetXmlContent<time_t>(node));
+            }
+        }
+    }
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef _Arena_h_
+#define _Arena_h_
+
+#include "Include/Foundation/SystemInclude.h"   /* uchar_t, size_t */
+#include <vector>
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+/**********************class Arena**********************/
+/*
+Arena, bump allocator.  Memory is cut from big blocks one after another and is
+never released one by one, all blocks are released together when the arena is
+destroyed.  Objects placed in an arena must not own any other heap memory, 
+their destructor is never called.
+Example:
+{
+    Arena arena;
+    TransportStream *ts = new(arena) TransportStream(tsId, onId, arena);
+}
+*/
+class Arena
+{
+public:
+    enum: size_t {MinBlockSize = 1024, MaxBlockSize = 64 * 1024};
+
+    Arena();
+    ~Arena();
+
+    void *Allocate(size_t size);
+    /* return size of all blocks, just for statistic. */
+    size_t GetCapacity() const;
+
+private:
+    /* arena can't be copied */
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+
+private:
+    std::vector<uchar_t *> blocks;
+    uchar_t *cur;
+    uchar_t *end;
+    size_t nextBlockSize;
+    size_t capacity;
+};
+
+inline void *operator new(size_t size, Arena &arena)
+{
+    return arena.Allocate(size);
+}
+
+/* called only if the constructor throws, memory is returned with the arena. */
+inline void operator delete(void *, Arena &)
+{
+}
+
+#endif /* _Arena_h_ */
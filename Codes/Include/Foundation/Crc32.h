@@ -1,14 +1,28 @@
-#ifndef _Crc32_h_
-#define _Crc32_h_
-
-/**********************class Crc32**********************/
-class Crc32
-{
-public:
-    Crc32();
-    ~Crc32();
-
-    static uint32_t CalculateCrc(const uchar_t *buffer, size_t bufferSize);
-};
-
+#ifndef _Crc32_h_
+#define _Crc32_h_
+
+/**********************class Crc32**********************/
+class Crc32
+{
+public:
+    Crc32();
+    ~Crc32();
+
+    static uint32_t CalculateCrc(const uchar_t *buffer, size_t bufferSize);
+    /* continue the crc of previous bytes with the bytes of buffer, so a section can be
+       checked piece by piece:  UpdateCrc(CalculateCrc(a, n), a + n, m) == CalculateCrc(a, n + m).
+       the crc of no byte is 0xFFFFFFFF.
+     */
+    static uint32_t UpdateCrc(uint32_t crc, const uchar_t *buffer, size_t bufferSize);
+    /* return the crc of the buffer after buffer[offset] is changed from oldValue to newValue,
+       "crc" is the crc of the buffer before the change.  cost is O(log(bufferSize)).
+     */
+    static uint32_t PatchCrc(uint32_t crc, size_t bufferSize, size_t offset,
+                             uchar_t oldValue, uchar_t newValue);
+
+private:
+    static uint32_t MultiplyModulo(uint32_t a, uint32_t b);
+    static uint32_t XPowerModulo(uint64_t n);
+};
+
 #endif /* _Crc32_h_ */
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef _XxHash_h_
+#define _XxHash_h_
+
+/**********************class XxHash**********************/
+/* 64 bits xxHash (XXH64), a fast non-cryptographic hash, used to detect 
+   identical xml file and identical SiTable content.
+ */
+class XxHash
+{
+public:
+    /* seed: hash of the previous data when hashing several pieces one by one. */
+    static uint64_t CalculateHash(const uchar_t *buffer, size_t bufferSize, uint64_t seed = 0);
+};
+
+#endif /* _XxHash_h_ */
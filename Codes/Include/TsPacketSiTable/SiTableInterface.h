@@ -1,72 +1,131 @@
-#ifndef _SiTableInterface_h_
-#define _SiTableInterface_h_
-
-/**********************class SiTableInterface**********************/
-class SiTableInterface
-{
-public: 
-    SiTableInterface(){};
-    virtual ~SiTableInterface(){};
-    
-    virtual void AddDescriptor(std::string &data) 
-    { assert(false);}
-    virtual void AddEvent(EventId eventId, const char *startTime, time_t duration,
-                          uint16_t  runningStatus, uint16_t freeCaMode)
-    { assert(false);}
-    virtual void AddEventDescriptor(EventId eventId, std::string &data)
-    { assert(false);}
-    virtual void AddService(ServiceId serviceId, uchar_t eitScheduleFlag, 
-                            uchar_t eitPresentFollowingFlag, uint16_t runningStatus, 
-                            uint16_t freeCaMode)
-    { assert(false);}
-    virtual void AddServiceDescriptor(ServiceId serviceId, std::string &data)
-    { assert(false);}
-    virtual void AddTs(TsId tsId, OnId onId) 
-    { assert(false);}
-    virtual void AddTsDescriptor(TsId tsId, std::string &data) 
-    { assert(false);}
-
-    virtual size_t GetCodesSize(TableId tableId, TsId tsId, 
-                                SectionNumber secIndex) const = 0;
-    //nit: network_id, sdt: transport_stream_id, bat: bouquet_id, eit: transport_stream_id+service_id
-    virtual SiTableKey GetKey() const = 0;  
-    virtual uint_t GetSecNumber(TableId tableId, TsId tsId) const = 0;
-    //table type: nit 0x41, 0x41; sdt 0x42, 0x46;  bat 0x4a; eit 0x4e, 0x4f, 0x50, 0x60
-    virtual TableId GetTableId() const = 0;  
-    virtual size_t MakeCodes(TableId tableId, TsId tsId, 
-		                     uchar_t *buffer, size_t bufferSize, 
-                             SectionNumber secIndex) const = 0;
-    virtual void RefreshCatch() {};
-
-    /* static function */
-    static SiTableInterface * CreateBatInstance(TableId tableId, BouquetId bouquetId,  Version versionNumber);
-    static SiTableInterface * CreateEitInstance(TableId tableId, ServiceId serviceId, Version versionNumber,
-                                                TsId transportStreamId, NetId originalNetworkId);
-    static SiTableInterface * CreateNitInstance(TableId tableId, NetId networkId,  Version versionNumber);
-    static SiTableInterface * CreateSdtInstance(TableId tableId, TsId transportStreamId, 
-                                                Version versionNumber, NetId originalNetworkId);
-};
-
-class CompareSiTableIdAndKey: public std::unary_function<SiTableInterface, bool>
-{
-public:
-    CompareSiTableIdAndKey(TableId tableId, SiTableKey key)
-        : tableId(tableId), key(key)
-    {}
-
-    result_type operator()(const argument_type &siTable)
-    {
-        return (result_type)(siTable.GetTableId() == tableId && siTable.GetKey() == key);
-    }    
-
-    result_type operator()(const argument_type *siTable)
-    {
-        return this->operator()(*siTable);
-    }
-
-private:
-    TableId  tableId;
-    SiTableKey key;
-};
-
+#ifndef _SiTableInterface_h_
+#define _SiTableInterface_h_
+
+/**********************class SiTableInterface**********************/
+class SiTableInterface
+{
+public: 
+    SiTableInterface(){};
+    virtual ~SiTableInterface(){};
+    
+    virtual void AddDescriptor(std::string &data) 
+    { assert(false);}
+    virtual void AddEvent(EventId eventId, const char *startTime, time_t duration,
+                          uint16_t  runningStatus, uint16_t freeCaMode)
+    { assert(false);}
+    virtual void AddEventDescriptor(EventId eventId, std::string &data)
+    { assert(false);}
+    virtual void AddService(ServiceId serviceId, uchar_t eitScheduleFlag, 
+                            uchar_t eitPresentFollowingFlag, uint16_t runningStatus, 
+                            uint16_t freeCaMode)
+    { assert(false);}
+    virtual void AddServiceDescriptor(ServiceId serviceId, std::string &data)
+    { assert(false);}
+    virtual void AddTs(TsId tsId, OnId onId) 
+    { assert(false);}
+    virtual void AddTsDescriptor(TsId tsId, std::string &data) 
+    { assert(false);}
+
+    /* codes of a section, GetCodesSize() bytes, made by the first call and kept by the
+       table until it is changed, so the section can be copied into ts packets without a
+       temporary buffer.  nullptr if the section does not exist.
+     */
+    virtual const uchar_t * GetCodes(TableId tableId, TsId tsId, SectionNumber secIndex) const = 0;
+    virtual size_t GetCodesSize(TableId tableId, TsId tsId, 
+                                SectionNumber secIndex) const = 0;
+    /* hash of the table header and of everything added by AddXxx(), tables built 
+       from same xml content have same fingerprint. 
+     */
+    virtual uint64_t GetFingerprint() const = 0;
+    /* hash of the table except version_number, tables with same sections (except
+       version_number) have same content fingerprint.
+     */
+    virtual uint64_t GetContentFingerprint() const = 0;
+    /* "*changeNumber" is increased whenever the sections of the table may change. it is
+       owned by the TransportPacket of the table and shared by the tables of same table id
+       and ts id, so the cached sizes are checked without asking every table.  nullptr if
+       the table is not in a TransportPacket.
+     */
+    virtual void SetChangeNumber(uint64_t *changeNumber) = 0;
+    /* the time when the table changes by itself (the present event ends ...), 
+       RefreshCatch() should be called at that time. 0 means never.
+     */
+    virtual time_t GetNextBoundary() const
+    { return 0; }
+    //nit: network_id, sdt: transport_stream_id, bat: bouquet_id, eit: transport_stream_id+service_id
+    virtual SiTableKey GetKey() const = 0;  
+    virtual uint_t GetSecNumber(TableId tableId, TsId tsId) const = 0;
+    /* start time of the first event of a section, only eit has it. */
+    virtual time_t GetSectionTime(TableId tableId, TsId tsId, SectionNumber secIndex) const
+    { return 0; }
+    //table type: nit 0x41, 0x41; sdt 0x42, 0x46;  bat 0x4a; eit 0x4e, 0x4f, 0x50, 0x60
+    virtual TableId GetTableId() const = 0;  
+    /* transport_stream_id of the ts which the table is sent for, false if the table is
+       sent for every ts (nit, bat).
+     */
+    virtual bool GetTsId(TsId &tsId) const
+    { return false; }
+    virtual Version GetVersion() const = 0;
+    /* called before the table replaces "old" (same table id and key), the table reuses the
+       codes of unchanged sections of "old", and decides its version_number by the difference:
+       the version of "old" if nothing is changed, a new one otherwise.  only eit has it.
+     */
+    virtual void Inherit(const SiTableInterface &old) {};
+    virtual size_t MakeCodes(TableId tableId, TsId tsId, 
+		                     uchar_t *buffer, size_t bufferSize, 
+                             SectionNumber secIndex) const = 0;
+    virtual void RefreshCatch() {};
+    /* called by the table builder after the last Add*() call, the table releases the
+       memory it only needed during construction (lookup index ...). eit and sdt adopt
+       the events/services of an identical table sealed before (eit actual and eit other
+       of a service ...), so they are kept once.
+     */
+    virtual void Seal() {};
+    /* replace the version_number of the xml file, fingerprints are not changed. */
+    virtual void SetVersion(Version versionNumber) = 0;
+
+    /* static function */
+    static SiTableInterface * CreateBatInstance(TableId tableId, BouquetId bouquetId,  Version versionNumber);
+    static SiTableInterface * CreateEitInstance(TableId tableId, ServiceId serviceId, Version versionNumber,
+                                                TsId transportStreamId, NetId originalNetworkId);
+    static SiTableInterface * CreateNitInstance(TableId tableId, NetId networkId,  Version versionNumber);
+    static SiTableInterface * CreateSdtInstance(TableId tableId, TsId transportStreamId, 
+                                                Version versionNumber, NetId originalNetworkId);
+    /* segment eit schedule across table_id 0x50-0x5F, 0x60-0x6F (ETSI TS 101 211),
+       it is off by default, all schedule events are packed into table_id 0x50 or 0x60.
+     */
+    static void SetEitSegmentation(bool enabled);
+    /* statistics of the section store shared by all tables. */
+    static void PutSectionStore(std::ostream& os);
+    /* number of eit event models and sdt service models which can be adopted by Seal(). */
+    static size_t GetModelNumber();
+    /* only the eit schedule events which start within "horizon" seconds are encoded, the
+       later ones are not encoded until they move into the horizon, but their events and 
+       descriptors are kept in memory as all other events. 0: no limit.
+     */
+    static void SetEitHorizon(time_t horizon);
+};
+
+class CompareSiTableIdAndKey: public std::unary_function<SiTableInterface, bool>
+{
+public:
+    CompareSiTableIdAndKey(TableId tableId, SiTableKey key)
+        : tableId(tableId), key(key)
+    {}
+
+    result_type operator()(const argument_type &siTable)
+    {
+        return (result_type)(siTable.GetTableId() == tableId && siTable.GetKey() == key);
+    }    
+
+    result_type operator()(const argument_type *siTable)
+    {
+        return this->operator()(*siTable);
+    }
+
+private:
+    TableId  tableId;
+    SiTableKey key;
+};
+
 #endif
\ No newline at end of file
@@ -1,46 +1,215 @@
-#include "Include/Foundation/SystemInclude.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/Debug.h"
-
-/* Configuration */
-#include "TimerCfg.h"
-using namespace std;
-
-TimerCfgInterface * TimerCfgInterface::CreateInstance()
-{
-    return new TimerCfg;
-}
-
-/**********************class TimerCfg**********************/
-/* public function */
-TimerCfg::TimerCfg()
-{
-}
-
-TimerCfg::~TimerCfg()
-{
-}
-
-time_t TimerCfg::GetInterval(TableId tableId) const
-{
-    map<TableId, time_t>::const_iterator iter;
-    iter = timerCfg.find(tableId);
-    assert(iter != timerCfg.end());
-    return iter->second;
-}
-
-void TimerCfg::SetInterval(TableId tableId, time_t sec)
-{
-    map<TableId, time_t>::iterator iter;
-    iter = timerCfg.find(tableId);
-    if (iter == timerCfg.end())
-    {
-        timerCfg.insert(make_pair(tableId, sec));
-    }
-    else
-    {
-        iter->second = sec;
-    }
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+
+/* Configuration */
+#include "TimerCfg.h"
+using namespace std;
+
+TimerCfgInterface * TimerCfgInterface::CreateInstance()
+{
+    return new TimerCfg;
+}
+
+/**********************class TimerCfg**********************/
+/* public function */
+TimerCfg::TimerCfg()
+    : receiverBitrate(0), datagramSize(UdpPayloadSize / TsPacketSize), stagger(100), tick(10), window(20),
+      eitSegmentation(false), eitHorizon(0), autoVersion(false)
+{
+    /* ETR 211, 4.4 Repetition rates */
+    maxIntervals.insert(make_pair(NitActualTableId, 10));
+    maxIntervals.insert(make_pair(NitOtherTableId, 10));
+    maxIntervals.insert(make_pair(BatTableId, 10));
+    maxIntervals.insert(make_pair(SdtActualTableId, 2));
+    maxIntervals.insert(make_pair(SdtOtherTableId, 10));
+    maxIntervals.insert(make_pair(EitActualPfTableId, 2));
+    maxIntervals.insert(make_pair(EitOtherPfTableId, 10));
+    maxIntervals.insert(make_pair(EitActualSchTableId, 10));
+    maxIntervals.insert(make_pair(EitOtherSchTableId, 30));
+}
+
+TimerCfg::~TimerCfg()
+{
+}
+
+bool TimerCfg::GetAutoVersion() const
+{
+    return autoVersion;
+}
+
+uint_t TimerCfg::GetBitrate(Pid pid) const
+{
+    map<Pid, uint_t>::const_iterator iter = bitrates.find(pid);
+    return (iter == bitrates.end() ? 0 : iter->second);
+}
+
+const vector<pair<time_t, uint_t>>& TimerCfg::GetEitTiers() const
+{
+    return eitTiers;
+}
+
+bool TimerCfg::GetEitSegmentation() const
+{
+    return eitSegmentation;
+}
+
+time_t TimerCfg::GetEitHorizon() const
+{
+    return eitHorizon;
+}
+
+uint_t TimerCfg::GetDatagramSize() const
+{
+    return datagramSize;
+}
+
+time_t TimerCfg::GetInterval(TableId tableId) const
+{
+    map<TableId, time_t>::const_iterator iter;
+    iter = timerCfg.find(tableId);
+    assert(iter != timerCfg.end());
+    return iter->second;
+}
+
+time_t TimerCfg::GetMaxInterval(TableId tableId) const
+{
+    map<TableId, time_t>::const_iterator iter;
+    iter = maxIntervals.find(tableId);
+    assert(iter != maxIntervals.end());
+    return iter->second;
+}
+
+uint_t TimerCfg::GetReceiverBitrate() const
+{
+    return receiverBitrate;
+}
+
+bool TimerCfg::GetSectionPacking(Pid pid) const
+{
+    return packedPids.find(pid) != packedPids.end();
+}
+
+uint_t TimerCfg::GetStagger() const
+{
+    return stagger;
+}
+
+uint_t TimerCfg::GetTick() const
+{
+    return tick;
+}
+
+uint_t TimerCfg::GetWindow() const
+{
+    return window;
+}
+
+void TimerCfg::AddEitTier(time_t distance, uint_t multiple)
+{
+    if (multiple == 0)
+    {
+        errstrm << "multiple of eit tier can't be 0, use 1." << endl;
+        multiple = 1;
+    }
+
+    /* keep tiers sorted by distance, distance 0 (the rest) is the last one. */
+    vector<pair<time_t, uint_t>>::iterator iter;
+    for (iter = eitTiers.begin(); iter != eitTiers.end(); ++iter)
+    {
+        if (iter->first == 0 || (distance != 0 && distance < iter->first))
+        {
+            break;
+        }
+    }
+    eitTiers.insert(iter, make_pair(distance, multiple));
+}
+
+void TimerCfg::SetAutoVersion(bool enabled)
+{
+    autoVersion = enabled;
+}
+
+void TimerCfg::SetBitrate(Pid pid, uint_t kbps)
+{
+    bitrates[pid] = kbps;
+}
+
+void TimerCfg::SetDatagramSize(uint_t packetNumber)
+{
+    if (packetNumber == 0 || packetNumber > MaxUdpPayloadSize / TsPacketSize)
+    {
+        errstrm << "invalid datagram size " << packetNumber << ", use " 
+                << datagramSize << " ts packets." << endl;
+        return;
+    }
+    datagramSize = packetNumber;
+}
+
+void TimerCfg::SetEitSegmentation(bool enabled)
+{
+    eitSegmentation = enabled;
+}
+
+void TimerCfg::SetEitHorizon(time_t sec)
+{
+    eitHorizon = sec;
+}
+
+void TimerCfg::SetInterval(TableId tableId, time_t sec)
+{
+    map<TableId, time_t>::iterator iter;
+    iter = timerCfg.find(tableId);
+    if (iter == timerCfg.end())
+    {
+        timerCfg.insert(make_pair(tableId, sec));
+    }
+    else
+    {
+        iter->second = sec;
+    }
+}
+
+void TimerCfg::SetMaxInterval(TableId tableId, time_t sec)
+{
+    maxIntervals[tableId] = sec;
+}
+
+void TimerCfg::SetReceiverBitrate(uint_t kbps)
+{
+    receiverBitrate = kbps;
+}
+
+void TimerCfg::SetSectionPacking(Pid pid, bool enabled)
+{
+    if (enabled)
+    {
+        packedPids.insert(pid);
+    }
+    else
+    {
+        packedPids.erase(pid);
+    }
+}
+
+void TimerCfg::SetStagger(uint_t percent)
+{
+    stagger = std::min(percent, (uint_t)100);
+}
+
+void TimerCfg::SetTick(uint_t msec)
+{
+    if (msec == 0)
+    {
+        errstrm << "tick of scheduler can't be 0, use " << tick << " milliseconds." << endl;
+        return;
+    }
+    tick = msec;
+}
+
+void TimerCfg::SetWindow(uint_t msec)
+{
+    window = msec;
 }
\ No newline at end of file
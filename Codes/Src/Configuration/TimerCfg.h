@@ -1,19 +1,55 @@
-#ifndef _TimerCfg_h_
-#define _TimerCfg_h_
-
-#include "Include/Configuration/TimerCfgInterface.h"
-
-class TimerCfg: public TimerCfgInterface
-{
-public:
-    TimerCfg();
-    ~TimerCfg();
-
-    time_t GetInterval(TableId tableId) const;
-    void SetInterval(TableId tableId, time_t sec);
-
-private:
-    std::map<TableId, time_t> timerCfg;
-};
-
+#ifndef _TimerCfg_h_
+#define _TimerCfg_h_
+
+#include "Include/Configuration/TimerCfgInterface.h"
+
+class TimerCfg: public TimerCfgInterface
+{
+public:
+    TimerCfg();
+    ~TimerCfg();
+
+    bool GetAutoVersion() const;
+    uint_t GetBitrate(Pid pid) const;
+    uint_t GetDatagramSize() const;
+    const std::vector<std::pair<time_t, uint_t>>& GetEitTiers() const;
+    bool GetEitSegmentation() const;
+    time_t GetEitHorizon() const;
+    time_t GetInterval(TableId tableId) const;
+    time_t GetMaxInterval(TableId tableId) const;
+    uint_t GetReceiverBitrate() const;
+    bool GetSectionPacking(Pid pid) const;
+    uint_t GetStagger() const;
+    uint_t GetTick() const;
+    uint_t GetWindow() const;
+    void AddEitTier(time_t distance, uint_t multiple);
+    void SetAutoVersion(bool enabled);
+    void SetBitrate(Pid pid, uint_t kbps);
+    void SetDatagramSize(uint_t packetNumber);
+    void SetEitSegmentation(bool enabled);
+    void SetEitHorizon(time_t sec);
+    void SetInterval(TableId tableId, time_t sec);
+    void SetMaxInterval(TableId tableId, time_t sec);
+    void SetReceiverBitrate(uint_t kbps);
+    void SetSectionPacking(Pid pid, bool enabled);
+    void SetStagger(uint_t percent);
+    void SetTick(uint_t msec);
+    void SetWindow(uint_t msec);
+
+private:
+    std::map<TableId, time_t> timerCfg;
+    std::map<TableId, time_t> maxIntervals;
+    std::map<Pid, uint_t> bitrates;
+    std::set<Pid> packedPids;
+    std::vector<std::pair<time_t, uint_t>> eitTiers;
+    uint_t receiverBitrate;
+    uint_t datagramSize;
+    uint_t stagger;
+    uint_t tick;
+    uint_t window;
+    bool   eitSegmentation;
+    time_t eitHorizon;
+    bool   autoVersion;
+};
+
 #endif
\ No newline at end of file
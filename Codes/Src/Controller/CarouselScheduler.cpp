@@ -0,0 +1,270 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+
+/* Configuration */
+#include "Include/Configuration/TimerCfgInterface.h"
+
+/* Controller */
+#include "CarouselScheduler.h"
+using namespace std;
+
+/* pseudo pid of the stream of all si pids of a network. */
+#define AllSiPid 0xFFFF
+
+static const TableId SiTableIds[] =
+{
+    NitActualTableId, NitOtherTableId, SdtActualTableId, SdtOtherTableId, BatTableId,
+    EitActualPfTableId, EitOtherPfTableId, EitActualSchTableId, EitOtherSchTableId
+};
+
+/**********************class CarouselScheduler**********************/
+/* public function */
+CarouselScheduler::CarouselScheduler(TimerCfgInterface *timerCfg)
+    : timerCfg(timerCfg), deferredNumber(0), targetMissNumber(0)
+{
+}
+
+CarouselScheduler::~CarouselScheduler()
+{
+}
+
+uint_t CarouselScheduler::GetInterval(NetId netId, TableId tableId) const
+{
+    uint_t interval = (uint_t)(timerCfg->GetInterval(tableId) * 1000);
+    unordered_map<uint32_t, Table>::const_iterator tableIter = tables.find(GetTableKey(netId, tableId));
+    if (tableIter == tables.end())
+    {
+        return interval;
+    }
+
+    uint_t stretch = 100;
+    unordered_map<uint32_t, uint_t>::const_iterator iter;
+    iter = stretches.find(GetStreamKey(netId, tableIter->second.pid));
+    if (iter != stretches.end())
+    {
+        stretch = std::max(stretch, iter->second);
+    }
+    iter = stretches.find(GetStreamKey(netId, AllSiPid));
+    if (iter != stretches.end())
+    {
+        stretch = std::max(stretch, iter->second);
+    }
+
+    return (uint_t)((uint64_t)interval * stretch / 100);
+}
+
+uint64_t CarouselScheduler::GetDeferredNumber() const
+{
+    return deferredNumber;
+}
+
+uint64_t CarouselScheduler::GetTargetMissNumber() const
+{
+    return targetMissNumber;
+}
+
+void CarouselScheduler::Pop(uint64_t tick, std::list<TimerArg> &due)
+{
+    uint_t receiverKbps = timerCfg->GetReceiverBitrate();
+    Queue::iterator iter = queue.begin();
+    while (iter != queue.end())
+    {
+        const Entry &entry = iter->second;
+        uint_t pidKbps = timerCfg->GetBitrate(entry.pid);
+        uint32_t netKey = GetStreamKey(entry.netId, AllSiPid);
+        uint32_t pidKey = GetStreamKey(entry.netId, entry.pid);
+
+        /* both buckets are refilled, even if the first one is empty. */
+        bool netReady = Refill(netKey, receiverKbps, tick);
+        bool pidReady = Refill(pidKey, pidKbps, tick);
+        if (!netReady || !pidReady)
+        {
+            ++deferredNumber;
+            ++iter;
+            continue;
+        }
+
+        unordered_map<uint32_t, Table>::iterator tableIter;
+        tableIter = tables.find(GetTableKey(entry.netId, entry.tableId));
+        size_t size = (tableIter == tables.end() ? 0 : tableIter->second.size);
+        Consume(netKey, receiverKbps, size);
+        Consume(pidKey, pidKbps, size);
+
+        uint_t lateness = (uint_t)(tick > iter->first ? tick - iter->first : 0);
+        due.push_back(TimerArg(entry.netId, entry.tableId, lateness));
+        queued.erase(GetTableKey(entry.netId, entry.tableId));
+        iter = queue.erase(iter);
+    }
+}
+
+void CarouselScheduler::Push(NetId netId, Pid pid, TableId tableId, uint64_t deadline)
+{
+    uint32_t key = GetTableKey(netId, tableId);
+    unordered_map<uint32_t, Queue::iterator>::iterator iter = queued.find(key);
+    if (iter != queued.end())
+    {
+        if (iter->second->first <= deadline)
+        {
+            return;
+        }
+        queue.erase(iter->second);
+        queued.erase(iter);
+    }
+
+    Queue::iterator position = queue.insert(make_pair(deadline, Entry(netId, pid, tableId)));
+    queued.insert(make_pair(key, position));
+}
+
+bool CarouselScheduler::Remove(NetId netId, TableId tableId)
+{
+    uint32_t key = GetTableKey(netId, tableId);
+    unordered_map<uint32_t, Queue::iterator>::iterator queuedIter = queued.find(key);
+    if (queuedIter != queued.end())
+    {
+        queue.erase(queuedIter->second);
+        queued.erase(queuedIter);
+    }
+    missedTargets.erase(key);
+
+    unordered_map<uint32_t, Table>::iterator tableIter = tables.find(key);
+    if (tableIter == tables.end())
+    {
+        return false;
+    }
+
+    Pid pid = tableIter->second.pid;
+    tables.erase(tableIter);
+    return UpdateStretches(netId, pid);
+}
+
+bool CarouselScheduler::SetSize(NetId netId, Pid pid, TableId tableId, size_t size)
+{
+    /* eit schedule sends different sections in different rounds, the load is 
+       calculated with the average size.
+     */
+    Table &table = tables[GetTableKey(netId, tableId)];
+    table.pid = pid;
+    table.size = (table.size == 0 ? size : (table.size * 3 + size) / 4);
+
+    return UpdateStretches(netId, pid);
+}
+
+/* private function */
+uint32_t CarouselScheduler::GetTableKey(NetId netId, TableId tableId)
+{
+    return ((uint32_t)netId << 8) | tableId;
+}
+
+uint32_t CarouselScheduler::GetStreamKey(NetId netId, Pid pid)
+{
+    return ((uint32_t)netId << 16) | pid;
+}
+
+bool CarouselScheduler::UpdateStretches(NetId netId, Pid pid)
+{
+    bool changed = false;
+    uint32_t streamKeys[] = {GetStreamKey(netId, pid), GetStreamKey(netId, AllSiPid)};
+    uint_t   kbps[] = {timerCfg->GetBitrate(pid), timerCfg->GetReceiverBitrate()};
+    for (size_t i = 0; i < 2; ++i)
+    {
+        uint_t stretch = CalculateStretch(netId, (i == 0 ? pid : AllSiPid), kbps[i]);
+        uint_t &current = stretches[streamKeys[i]];
+        if (current != stretch)
+        {
+            current = stretch;
+            changed = true;
+        }
+    }
+
+    if (!changed)
+    {
+        return false;
+    }
+
+    /* report tables whose stretched interval misses the ETR 211 target. */
+    for (size_t i = 0; i < sizeof(SiTableIds) / sizeof(SiTableIds[0]); ++i)
+    {
+        uint32_t key = GetTableKey(netId, SiTableIds[i]);
+        if (tables.find(key) == tables.end())
+        {
+            continue;
+        }
+
+        uint_t interval = GetInterval(netId, SiTableIds[i]);
+        if (interval <= timerCfg->GetMaxInterval(SiTableIds[i]) * 1000)
+        {
+            missedTargets.erase(key);
+        }
+        else if (missedTargets.insert(key).second)
+        {
+            ++targetMissNumber;
+            errstrm << "Bitrate budget of network " << netId << " is too small, interval of table "
+                    << (uint_t)SiTableIds[i] << " is stretched to " << interval
+                    << " milliseconds." << endl;
+        }
+    }
+
+    return true;
+}
+
+bool CarouselScheduler::Refill(uint32_t streamKey, uint_t kbps, uint64_t tick)
+{
+    if (kbps == 0)
+    {
+        return true;
+    }
+
+    /* 1 kbps = 1000 bits per second = 1 byte per 8 milliseconds. */
+    int64_t burst = (int64_t)kbps * 1000 / 8;
+    Bucket &bucket = buckets[streamKey];
+    if (!bucket.initialized)
+    {
+        bucket.tokens = burst;
+        bucket.initialized = true;
+    }
+    else if (tick > bucket.tick)
+    {
+        int64_t refill = (int64_t)(tick - bucket.tick) * timerCfg->GetTick() * kbps / 8;
+        bucket.tokens = std::min(bucket.tokens + refill, burst);
+    }
+    bucket.tick = tick;
+
+    return bucket.tokens > 0;
+}
+
+void CarouselScheduler::Consume(uint32_t streamKey, uint_t kbps, size_t size)
+{
+    if (kbps == 0)
+    {
+        return;
+    }
+    buckets[streamKey].tokens -= (int64_t)size;
+}
+
+uint_t CarouselScheduler::CalculateStretch(NetId netId, Pid pid, uint_t kbps) const
+{
+    if (kbps == 0)
+    {
+        return 100;
+    }
+
+    /* load of the stream with the configured intervals, in bits per second. */
+    uint64_t load = 0;
+    for (size_t i = 0; i < sizeof(SiTableIds) / sizeof(SiTableIds[0]); ++i)
+    {
+        unordered_map<uint32_t, Table>::const_iterator iter;
+        iter = tables.find(GetTableKey(netId, SiTableIds[i]));
+        if (iter == tables.end() || (pid != AllSiPid && iter->second.pid != pid))
+        {
+            continue;
+        }
+
+        uint64_t interval = std::max((uint64_t)timerCfg->GetInterval(SiTableIds[i]) * 1000, (uint64_t)1);
+        load = load + (uint64_t)iter->second.size * 8 * 1000 / interval;
+    }
+
+    return (uint_t)std::max(load * 100 / ((uint64_t)kbps * 1000), (uint64_t)100);
+}
@@ -0,0 +1,113 @@
+#ifndef _CarouselScheduler_h_
+#define _CarouselScheduler_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+/* Controller */
+#include "TimerWheel.h"
+
+class TimerCfgInterface;
+
+/**********************class CarouselScheduler**********************/
+/* earliest-deadline-first queue of due tables with bitrate budgets.
+   1 every {NetId, Pid} stream and every NetId (all si pids of a receiver) has a token
+     bucket, refilled by the budget of sender.xml every tick, the burst is 1 second of
+     budget.  due tables are popped earliest-deadline-first while their buckets are
+     not empty, other tables stay in the queue for next tick.
+   2 the load of a stream is sum(table size * 8 / interval), if the load is larger than
+     the budget, the intervals of all tables of the stream are stretched by load / budget,
+     so the carousel fits the budget instead of overflowing it.  a stretched interval
+     longer than the ETR 211 target is reported.
+   Example:
+    CarouselScheduler scheduler(timerCfg);
+    scheduler.Push(netId, EitPid, EitActualSchTableId, deadline);
+    ...
+    list<TimerArg> due;
+    scheduler.Pop(tick, due);
+    send tables of due ...
+    if (scheduler.SetSize(netId, EitPid, EitActualSchTableId, size))
+    {
+        timerWheel->SetInterval(netId, tableId, scheduler.GetInterval(netId, tableId) / tick);
+    }
+ */
+class CarouselScheduler
+{
+public:
+    CarouselScheduler(TimerCfgInterface *timerCfg);
+    ~CarouselScheduler();
+
+    /* interval after stretching, in milliseconds. */
+    uint_t GetInterval(NetId netId, TableId tableId) const;
+    uint64_t GetDeferredNumber() const;
+    uint64_t GetTargetMissNumber() const;
+    /* refill the budgets to "tick", and move tables which can be sent in the tick to "due"
+       in deadline order.  TimerArg::lateness is the ticks between deadline and "tick".
+     */
+    void Pop(uint64_t tick, std::list<TimerArg> &due);
+    /* queue a due table, a table which is queued already keeps the earlier deadline. */
+    void Push(NetId netId, Pid pid, TableId tableId, uint64_t deadline);
+    /* the last table of {netId, tableId} is deleted, its size and queued entry are dropped.
+       return true if the intervals of tables of netId are changed.
+     */
+    bool Remove(NetId netId, TableId tableId);
+    /* update the encoded size of a table (max size of all receivers), in bytes.
+       return true if the intervals of tables of netId are changed.
+     */
+    bool SetSize(NetId netId, Pid pid, TableId tableId, size_t size);
+
+private:
+    struct Entry
+    {
+        Entry(NetId netId, Pid pid, TableId tableId)
+            : netId(netId), pid(pid), tableId(tableId)
+        {}
+
+        NetId   netId;
+        Pid     pid;
+        TableId tableId;
+    };
+    typedef std::multimap<uint64_t, Entry> Queue;
+
+    struct Table
+    {
+        Table(): pid(0), size(0)
+        {}
+
+        Pid    pid;
+        size_t size;
+    };
+
+    struct Bucket
+    {
+        Bucket(): tokens(0), tick(0), initialized(false)
+        {}
+
+        int64_t  tokens;    //bytes, negative if the last table exceeded the bucket.
+        uint64_t tick;      //tick of last refill.
+        bool     initialized;
+    };
+
+    static uint32_t GetTableKey(NetId netId, TableId tableId);
+    static uint32_t GetStreamKey(NetId netId, Pid pid);
+    bool Refill(uint32_t streamKey, uint_t kbps, uint64_t tick);
+    void Consume(uint32_t streamKey, uint_t kbps, size_t size);
+    uint_t CalculateStretch(NetId netId, Pid pid, uint_t kbps) const;
+    /* calculate the stretches of {netId, pid} and {netId, AllSiPid} again. */
+    bool UpdateStretches(NetId netId, Pid pid);
+
+private:
+    TimerCfgInterface *timerCfg;
+    Queue queue;
+    std::unordered_map<uint32_t, Queue::iterator> queued;   //{NetId, TableId} -> queue entry
+    std::unordered_map<uint32_t, Table>  tables;            //{NetId, TableId} -> encoded size
+    std::unordered_map<uint32_t, Bucket> buckets;           //{NetId, Pid} -> token bucket
+    std::unordered_map<uint32_t, uint_t> stretches;         //{NetId, Pid} -> stretch, in percent
+    std::set<uint32_t> missedTargets;                       //{NetId, TableId}
+    uint64_t deferredNumber;
+    uint64_t targetMissNumber;
+};
+
+#endif
@@ -1,507 +1,1046 @@
-#include "Include/Foundation/SystemInclude.h"
-#include <regex>
-#pragma warning(push)
-#pragma warning(disable:702)   //disable warning caused by ACE library.
-#pragma warning(disable:4251)  //disable warning caused by ACE library.
-#pragma warning(disable:4996)  //disable warning caused by ACE library.
-#include "ace/OS.h"
-#include "ace/Singleton.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/Debug.h"
-#include "Include/Foundation/Time.h"
-
-/* ConfigurationWrapper */
-#include "Include/ConfigurationWrapper/TimerCfgWrapperInterface.h"
-#include "Include/ConfigurationWrapper/NetworkCfgWrapperInterface.h"
-#include "Include/ConfigurationWrapper/NetworkRelationWrapperInterface.h"
-
-/* SiTableWrapper */
-#include "Include/SiTableWrapper/SiTableXmlWrapperInterface.h"
-
-/* TsPacketSiTable */
-#include "Include/TsPacketSiTable/SiTableInterface.h"
-#include "Include/TsPacketSiTable/TransportPacketInterface.h"
-
-/* Controller */
-#include "TimerRepository.h"
-#include "Controller.h"
-using namespace std;
-
-/**********************SiTableXmlWrapperRepository**********************/
-static SiTableXmlWrapperAutoRegisterSuite<SiTableInterface> batWrapper
-    (string("bat"), new BatXmlWrapper<SiTableInterface>);
-
-static SiTableXmlWrapperAutoRegisterSuite<SiTableInterface> eitWrapper
-    (string("eit"), new EitXmlWrapper<SiTableInterface>);
-
-static SiTableXmlWrapperAutoRegisterSuite<SiTableInterface> nitWrapper
-    (string("nit"), new NitXmlWrapper<SiTableInterface>);
-
-static SiTableXmlWrapperAutoRegisterSuite<SiTableInterface> sdtWrapper
-    (string("sdt"), new SdtXmlWrapper<SiTableInterface>);
-
-ControllerInterface &ControllerInterface::GetInstance()
-{
-    typedef ACE_Singleton<Controller, ACE_Recursive_Thread_Mutex> TheController;
-
-    return *TheController::instance();
-}
-
-
-/**********************class Controller**********************/
-/* public function */
-Controller::Controller()
-    : tsPackets(nullptr), timerRepository(nullptr)
-{
-    tableNameToPid.insert(make_pair("nit", NitPid));
-    tableNameToPid.insert(make_pair("bat", BatPid));
-    tableNameToPid.insert(make_pair("sdt", SdtPid));
-    tableNameToPid.insert(make_pair("eit", EitPid));
-
-    tableIdToPid.insert(make_pair(NitActualTableId, NitPid));
-    tableIdToPid.insert(make_pair(NitOtherTableId, NitPid));
-    tableIdToPid.insert(make_pair(SdtActualTableId, SdtPid));
-    tableIdToPid.insert(make_pair(SdtOtherTableId, SdtPid));
-    tableIdToPid.insert(make_pair(BatTableId, BatPid));
-    tableIdToPid.insert(make_pair(EitActualPfTableId, EitPid));
-    tableIdToPid.insert(make_pair(EitOtherPfTableId, EitPid));
-    tableIdToPid.insert(make_pair(EitActualSchTableId, EitPid));
-    tableIdToPid.insert(make_pair(EitOtherSchTableId, EitPid));
-
-    dirHandle = ACE_INVALID_HANDLE;
-}
-
-Controller::~Controller()
-{
-    ACE_Reactor *reactor = this->reactor();
-    
-    /* stop monitoring dir 
-    * remove_handler() may put event in Reactor's event queue, and the the event will cause a
-    * invoke to ACE_Event_Handler::handle_close(). 
-    * now we call remove_handler() in destruct function, that ACE_Event_Handler::handle_close()
-    * will occur at sometime this Controller is invalid.  In order to avoid invalid calling to
-    * handle_close(), we set the ACE_Event_Handler::DONT_CALL bit.
-    */
-    ACE_Reactor_Mask mask = ACE_Event_Handler::ALL_EVENTS_MASK | ACE_Event_Handler::DONT_CALL;
-    reactor->remove_handler(dirHandle, mask);
-    ::FindCloseChangeNotification(dirHandle);
-    dirHandle = ACE_INVALID_HANDLE;
-
-    /* clear file summary */
-    fileSummaries.clear();
-    
-    /* cancle timers */
-    TimerRepository::iterator iter;
-    for (iter = timerRepository->Begin(); iter != timerRepository->End(); ++iter)
-    {
-        reactor->cancel_timer(iter->first);
-    }
-    delete timerRepository;    
-    delete tsPackets;
-
-    /* free configuration */
-    delete dirCfg;
-    delete networkCfgs;
-    delete timerCfg;
-}
-
-int Controller::handle_signal(int signum, siginfo_t *, ucontext_t *)
-{
-    DWORD waitStatus;
-    waitStatus = WaitForMultipleObjects(1, &dirHandle, FALSE, INFINITE); 
-    if (waitStatus != WAIT_OBJECT_0)
-    {
-        return 0;
-    }
-    
-    string ok = string(dirCfg->GetXmlDir()) + string("\\ok");
-	while((ACE_OS::access(ok.c_str(), F_OK)) != 0)
-    {
-        Sleep(10);
-    }
-    
-    ReadDir(dirCfg->GetXmlDir());
-
-    ::FindNextChangeNotification(dirHandle);
-    return 0;
-}
-
-int Controller::handle_timeout(const ACE_Time_Value &currentTime,
-                               const void *act)
-{
-    string pause = string(dirCfg->GetXmlDir()) + string("\\pause");
-    if (ACE_OS::access(pause.c_str(), F_OK) == 0)
-    {
-        return 0;
-    }
-
-    TimerArg &timerArg = *(TimerArg *)act;
-    NetId netId = timerArg.netId;
-    TableId tableId = timerArg.tableId;
-    Pid pid = tableIdToPid.find(tableId)->second;
-
-    TransportPacketsInterface::iterator tsPacketIter = tsPackets->Find(netId, pid);
-    assert(tsPacketIter != tsPackets->End());
-    (*tsPacketIter)->RefreshCatch();
-
-    NetworkCfgsInterface::iterator networkIter;
-    for (networkIter = networkCfgs->Begin(); networkIter != networkCfgs->End(); ++networkIter)
-    {
-        NetworkCfgInterface *network = *networkIter;
-        if (!networkCfgs->IsChildNetwork(netId, network->GetNetId()))
-        {
-            continue;
-        }
-        
-        SendUdp(network, *tsPacketIter, tableId);
-    }   
-    
-    return 0;
-}
-
-#define TestReadXmlPerformance
-bool Controller::Start(ACE_Reactor *reactor, const char *xmlPath)
-{
-    error_code errCode;
-    /********* Step 1: Init Configuration *********/
-    /* dir configuration */
-    dirCfg = DirCfgInterface::CreateInstance(xmlPath);
-    
-    char *cfgDir = ACE_OS::getenv("EpgSenderData");    
-    if (cfgDir == nullptr)
-    {
-        errstrm << "Error when get environment variable of EpgSenderData" << endl;
-        return false;
-    }
-
-    /* networks configuration */
-    string receiverCfgPath = string(cfgDir) + string("\\receiver.xml");
-    networkCfgs = NetworkCfgsInterface::CreateInstance();
-    NetworkCfgWrapperInterface<NetworkCfgsInterface, NetworkCfgInterface, ReceiverInterface> networkCfgWrapper;
-    errCode = networkCfgWrapper.Select(*networkCfgs, receiverCfgPath.c_str());
-    if (errCode)
-    {
-        cout << "Error when reading " << receiverCfgPath << ", error message: " << errCode.message() << endl;
-        return false;
-    }
-
-    /* timer configuration */
-    string senderCfgPath = string(cfgDir) + string("\\sender.xml");
-    timerCfg = TimerCfgInterface::CreateInstance();
-    TimerCfgWrapperInterface<TimerCfgInterface> timerCfgWrapper;
-    errCode = timerCfgWrapper.Select(*timerCfg, senderCfgPath.c_str());
-    if (errCode)
-    {
-        errstrm << "Error when reading " << senderCfgPath << ", error message: " << errCode.message() << endl;
-        return false;
-    }
-
-    /********* Step 2: Init Reactor *********/
-    this->reactor (reactor);    
-
-    /********* Step 3: Setup Runtime Information *********/
-    /* this->tsPackets */
-    tsPackets = TransportPacketsInterface::CreateInstance();    
-
-    /* Timer Repository(timer runtimer information) */
-    timerRepository = new TimerRepository();    
-
-#ifdef TestReadXmlPerformance
-    TimeMeter timeMeter;
-    timeMeter.Start();
-
-    ReadDir(dirCfg->GetXmlDir());
-
-    timeMeter.End();
-    cout << "elapsed time(milliseconds): " << timeMeter.GetDuration().count() << endl;
-#else
-    ReadDir(dirCfg->GetXmlDir());
-#endif
-
-    AddMonitoredDir(dirCfg->GetXmlDir());
-    //AddMonitoredDir(dirCfg->GetTsDir()); 
-    return true;
-}
-
-/* private function */
-void Controller::AnalyzeFileName(const char *path, NetId &netId, Pid &pid, string &type)
-{    
-   char drive[3];
-   char dir[PATH_MAX];
-   char fname[FILENAME_MAX];
-   char ext[FILENAME_MAX];
-   
-    _splitpath(path, drive, dir, fname, ext); 
-
-    char buffer[FILENAME_MAX];
-    char *start, *end;
-    size_t size;
-
-    /* Network Id */
-    start = fname;
-    end = strstr(fname, "_");
-    size = end - start;
-    memcpy(buffer, start, size);
-    buffer[size] = '\0';
-    netId = (NetId)strtol(buffer, nullptr, 0);
-
-    /* version */
-    start = end + 1;
-    end = strstr(start, "_");
-
-    /* nit|bat|sdt|eit */
-    start = end + 1;
-    end = strstr(start, "_");
-    size = end - start;
-    memcpy(buffer, start, size);
-    buffer[size] = '\0';
-    map<string, Pid>::iterator iter = tableNameToPid.find(buffer);
-    assert(iter != tableNameToPid.end());
-    pid = iter->second;
-    type = buffer;
-}
-
-void Controller::AddMonitoredDir(const char *directory)
-{
-    /* we can monitor one dir only. */
-    assert(dirHandle == ACE_INVALID_HANDLE);
-    int flags = FILE_NOTIFY_CHANGE_FILE_NAME;
-
-    dirHandle = ACE_TEXT_FindFirstChangeNotification(directory,  
-        FALSE, // flag for monitoring directory or directory tree
-        flags); // filter conditions to watch for        
-    assert(dirHandle != ACE_INVALID_HANDLE);
-    
-    int ret;
-    ret = this->reactor()->register_handler(this, dirHandle);
-    assert(ret == 0);
-}
-
-void Controller::AddSiTable(const char *path)
-{
-    NetId   netId;
-    Pid     pid;
-    string  type;
-    
-    AnalyzeFileName(path, netId, pid, type);    
-    
-    /* network relation */
-    NetworkRelationWrapperInterface<NetworkCfgsInterface> netRelationWrapper;
-    string relationXmlPath = string(dirCfg->GetXmlDir()) + string("\\NetWorkNode.xml");
-    error_code errCode = netRelationWrapper.Select(*networkCfgs, relationXmlPath.c_str());
-    if (errCode)
-    {
-        errstrm << "Error when reading " << relationXmlPath 
-             << ", error message: " << errCode.message() << endl;
-        return;
-    }
-        
-    /* Add SiSable to TsPacket */
-    TransportPacketInterface *tsPacket;
-    TransportPacketsInterface::iterator iter = tsPackets->Find(netId, pid);
-    if (iter == tsPackets->End())
-    {
-        tsPacket = TransportPacketInterface::CreateInstance(netId, pid);
-        tsPackets->Add(tsPacket);
-    }
-    else
-    {
-        tsPacket = *iter;
-    }
-
-    typedef SiTableXmlWrapperRepository<SiTableInterface> Repository;
-    typedef SiTableXmlWrapperInterface<SiTableInterface> Wrapper;
-
-    Repository &repository = Repository::GetInstance();
-    Wrapper &siTableWrapper = repository.GetWrapperInstance(type);
-    list<SiTableInterface*> siTables = siTableWrapper.Select(path);
-    
-    /* save {file name, table id, key list} relation ship */
-    FileSummary summary(path);
-    list<SiTableInterface*>::iterator ii;
-    for (ii = siTables.begin(); ii != siTables.end(); ++ii)
-    {
-        TableId    tableId  = (*ii)->GetTableId();
-        SiTableKey tableKey = (*ii)->GetKey();
-        SiTableIdAndKey tableIdAndKey = FileSummary::AssembleTableIdAndKey(tableId, tableKey);
-        summary.tableIdAndKeys.push_back(tableIdAndKey);
-        
-        /* schedule timer for {NetId, TableId} */
-        ScheduleTimer(netId, tableId);
-        if (tableId == EitActualSchTableId)
-        {
-            ScheduleTimer(netId, EitActualPfTableId);
-        }
-        else if (tableId == EitOtherSchTableId)
-        {
-            ScheduleTimer(netId, EitOtherPfTableId);
-        }
-                
-        tsPacket->AddSiTable(*ii);
-    }
-    fileSummaries.push_back(move(summary));
-
-}
-
-void Controller::DelSiTable(const char *path)
-{
-    NetId   netId;
-    Pid     pid;
-    string  type;
-    cout << "Removing " << path << endl;
-    AnalyzeFileName(path, netId, pid, type);   
-
-    TransportPacketsInterface::iterator iter = tsPackets->Find(netId, pid);
-    assert(iter != tsPackets->End());
-    TransportPacketInterface *tsPacket = *iter;
-
-    std::list<FileSummary>::iterator summaryIter;
-    summaryIter = find_if(fileSummaries.begin(), fileSummaries.end(), CompareSummaryFileName(path));
-    assert (summaryIter != fileSummaries.end());
-    list<SiTableIdAndKey>::iterator ii;
-    for (ii = summaryIter->tableIdAndKeys.begin(); ii != summaryIter->tableIdAndKeys.end(); ++ii)
-    {
-        TableId tableId = FileSummary::GetTableId(*ii);
-        SiTableKey tableKey = FileSummary::GetTableKey(*ii);
-
-        tsPacket->DelSiTable(tableId, tableKey);
-    }
-    fileSummaries.remove_if(CompareSummaryFileName(path));
-}
-
-void Controller::ReadDir(const char *dir)
-{    
-    list<string> newPathes, oldPathes;
-    
-	ACE_DIR *aceDir = ACE_OS::opendir(dir);
-	assert(aceDir != nullptr);
-	while (ACE_DIRENT *entry = ACE_OS::readdir(aceDir))
-	{
-		if (regex_match(entry->d_name, regex(".*(nit|bat|sdt|eit).*\\.xml")))
-        {
-            newPathes.push_back(string(dir) + string("\\") + string(entry->d_name));
-        }
-	}
-	ACE_OS::closedir(aceDir);
-
-    list<FileSummary>::iterator summeryIter;
-    for (summeryIter = fileSummaries.begin(); summeryIter != fileSummaries.end(); ++summeryIter)
-    {
-        oldPathes.push_back(summeryIter->fileName);
-    }
-
-    vector<string> added, deled;
-    
-    newPathes.sort();
-    oldPathes.sort();
-    set_difference(newPathes.begin(), newPathes.end(), 
-                   oldPathes.begin(), oldPathes.end(), 
-                   std::back_inserter(added));
-    for (vector<string>::iterator iter = added.begin(); iter != added.end(); ++iter)
-    {
-        AddSiTable(iter->c_str());
-    }
-
-    set_difference(oldPathes.begin(), oldPathes.end(), 
-                   newPathes.begin(), newPathes.end(), 
-                   std::back_inserter(deled));
-    for (vector<string>::iterator iter = deled.begin(); iter != deled.end(); ++iter)
-    {
-        DelSiTable(iter->c_str());
-    }
-}
-
-void Controller::SendUdp(NetworkCfgInterface *network, 
-                         TransportPacketInterface *tsPacket, 
-                         TableId tableId)
-{
-    static size_t bufferSize = 1024 * 1024 * 16;
-    static uchar_t *buffer = new uchar_t[bufferSize];
-    
-    NetworkCfgInterface::iterator receiverIter;
-    for (receiverIter =  network->Begin(); 
-         receiverIter != network->End(); 
-         ++receiverIter)
-    {
-        ReceiverInterface *receiver = *receiverIter;
-        if (receiverIter != network->Begin())
-        {
-            /* bat and sdt will only be sent to center frequency. */
-            if (tableId == BatTableId 
-                || tableId == NitActualTableId || tableId == NitOtherTableId)
-            {
-                break;
-            }
-        }
-
-        ReceiverId receiverId = receiver->GetReceiverId();
-        TsId tsId = receiver->GetTsId();
-        size_t size = tsPacket->GetCodesSize(tableId, tsId); 
-        
-        if (size > bufferSize)
-        {
-            bufferSize = bufferSize * 2;
-            delete[] buffer;
-            buffer = new uchar_t[bufferSize];
-            assert(bufferSize <= 1024*1024*512);
-        }
-        /* ReceiverId is is unique for every receiver, 
-           So we use ReceiverId as ccId index.
-         */
-        tsPacket->MakeCodes((CcId)receiverId, tableId, tsId, buffer, size);
-        ReceiverInterface::iterator pidMapIter;
-        for (pidMapIter = receiver->Begin(); pidMapIter != receiver->End(); ++pidMapIter)
-        {
-            tsPacket->MapPid(buffer, size, pidMapIter->first, pidMapIter->second);
-        }
-
-        int socketFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-        
-        int pktNumber = (size + UdpPayloadSize - 1) / UdpPayloadSize;
-        struct sockaddr_in dstAddr = receiver->GetDstAddr();
-        uchar_t bt = dstAddr.sin_addr.S_un.S_un_b.s_b1;        
-        if (bt >= 224 && bt <= 239)
-        {
-            /* Multicast destination address, set socket option */
-            if(setsockopt(socketFd, IPPROTO_IP, IP_MULTICAST_IF, 
-                          (char *)&network->GetSrcAddr(), sizeof(struct sockaddr_in)) < 0)
-            {
-                errstrm << "Error when set socket option." << endl;
-                closesocket(socketFd);
-                return;
-            }
-        }
-        for (int i = 0; i < pktNumber; ++i)
-        {
-            int udpSize = std::min((int)(size - UdpPayloadSize * i), (int)(UdpPayloadSize));
-            sendto(socketFd, (char*)buffer + UdpPayloadSize * i, (int)udpSize, 0, 
-                   (SOCKADDR *)&dstAddr, 
-                   sizeof(struct sockaddr_in));
-        }
-
-        closesocket(socketFd);
-    }    
-}
-
-void Controller::ScheduleTimer(NetId netId, TableId tableId)
-{
-    TimerArg *timerArg = new TimerArg(netId, tableId);
-    TimerRepository::iterator timerIter = timerRepository->Find(*timerArg);
-    if (timerIter == timerRepository->End())
-    {
-        time_t interval = timerCfg->GetInterval(tableId);
-        ACE_Time_Value delay(interval);
-        ACE_Reactor *reactor = this->reactor();    
-        TimerId timerId = reactor->schedule_timer(this, timerArg, ACE_Time_Value::zero, delay);
-
-        timerRepository->Add(timerId, timerArg);
-    }
-    else
-    {
-        delete timerArg;
-    }
-}
-
-#pragma warning(pop)
+#include "Include/Foundation/SystemInclude.h"
+#include <regex>
+#pragma warning(push)
+#pragma warning(disable:702)   //disable warning caused by ACE library.
+#pragma warning(disable:4251)  //disable warning caused by ACE library.
+#pragma warning(disable:4996)  //disable warning caused by ACE library.
+#include "ace/OS.h"
+#include "ace/Singleton.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/Time.h"
+#include "Include/Foundation/XxHash.h"
+
+/* ConfigurationWrapper */
+#include "Include/ConfigurationWrapper/TimerCfgWrapperInterface.h"
+#include "Include/ConfigurationWrapper/NetworkCfgWrapperInterface.h"
+#include "Include/ConfigurationWrapper/NetworkRelationWrapperInterface.h"
+
+/* SiTableWrapper */
+#include "Include/SiTableWrapper/SiTableXmlWrapperInterface.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+#include "Include/TsPacketSiTable/TransportPacketInterface.h"
+
+/* Controller */
+#include "TimerWheel.h"
+#include "Snapshot.h"
+#include "VersionRegistry.h"
+#include "DatagramPacker.h"
+#include "OverrunMonitor.h"
+#include "CarouselScheduler.h"
+#include "Controller.h"
+using namespace std;
+
+/* delay of writing snapshot file after xml files were changed, in seconds. */
+#define SnapshotSaveDelay 10
+/* interval of statistics report (section packing, shared sections), in seconds. */
+#define ReportInterval 3600
+
+/**********************SiTableXmlWrapperRepository**********************/
+/* tables are built through SiTableRecorder, so the building of every xml file 
+   can be saved to snapshot file and be replayed when restarting.
+ */
+static SiTableXmlWrapperAutoRegisterSuite<SiTableRecorder> batWrapper
+    (string("bat"), new BatXmlWrapper<SiTableRecorder>);
+
+static SiTableXmlWrapperAutoRegisterSuite<SiTableRecorder> eitWrapper
+    (string("eit"), new EitXmlWrapper<SiTableRecorder>);
+
+static SiTableXmlWrapperAutoRegisterSuite<SiTableRecorder> nitWrapper
+    (string("nit"), new NitXmlWrapper<SiTableRecorder>);
+
+static SiTableXmlWrapperAutoRegisterSuite<SiTableRecorder> sdtWrapper
+    (string("sdt"), new SdtXmlWrapper<SiTableRecorder>);
+
+ControllerInterface &ControllerInterface::GetInstance()
+{
+    typedef ACE_Singleton<Controller, ACE_Recursive_Thread_Mutex> TheController;
+
+    return *TheController::instance();
+}
+
+
+/**********************class Controller**********************/
+/* public function */
+Controller::Controller()
+    : tsPackets(nullptr), timerWheel(nullptr), wheelTimerId(-1), packer(nullptr), scheduler(nullptr), 
+      reportTick(0), snapshot(nullptr), snapshotTimerId(-1), versionRegistry(nullptr)
+{
+    tableNameToPid.insert(make_pair("nit", NitPid));
+    tableNameToPid.insert(make_pair("bat", BatPid));
+    tableNameToPid.insert(make_pair("sdt", SdtPid));
+    tableNameToPid.insert(make_pair("eit", EitPid));
+
+    tableIdToPid.insert(make_pair(NitActualTableId, NitPid));
+    tableIdToPid.insert(make_pair(NitOtherTableId, NitPid));
+    tableIdToPid.insert(make_pair(SdtActualTableId, SdtPid));
+    tableIdToPid.insert(make_pair(SdtOtherTableId, SdtPid));
+    tableIdToPid.insert(make_pair(BatTableId, BatPid));
+    tableIdToPid.insert(make_pair(EitActualPfTableId, EitPid));
+    tableIdToPid.insert(make_pair(EitOtherPfTableId, EitPid));
+    tableIdToPid.insert(make_pair(EitActualSchTableId, EitPid));
+    tableIdToPid.insert(make_pair(EitOtherSchTableId, EitPid));
+
+    dirHandle = ACE_INVALID_HANDLE;
+}
+
+Controller::~Controller()
+{
+    ACE_Reactor *reactor = this->reactor();
+    
+    /* stop monitoring dir 
+    * remove_handler() may put event in Reactor's event queue, and the the event will cause a
+    * invoke to ACE_Event_Handler::handle_close(). 
+    * now we call remove_handler() in destruct function, that ACE_Event_Handler::handle_close()
+    * will occur at sometime this Controller is invalid.  In order to avoid invalid calling to
+    * handle_close(), we set the ACE_Event_Handler::DONT_CALL bit.
+    */
+    ACE_Reactor_Mask mask = ACE_Event_Handler::ALL_EVENTS_MASK | ACE_Event_Handler::DONT_CALL;
+    reactor->remove_handler(dirHandle, mask);
+    ::FindCloseChangeNotification(dirHandle);
+    dirHandle = ACE_INVALID_HANDLE;
+
+    /* write pending snapshot */
+    if (snapshotTimerId != -1)
+    {
+        reactor->cancel_timer(snapshotTimerId);
+        SaveSnapshot();
+    }
+    delete snapshot;
+    delete versionRegistry;
+
+    /* clear file summary */
+    fileSummaries.clear();
+    
+    /* cancle timers */
+    if (wheelTimerId != -1)
+    {
+        reactor->cancel_timer(wheelTimerId);
+    }
+    delete timerWheel;    
+    delete tsPackets;
+
+    /* close sockets */
+    map<NetworkCfgInterface*, int>::iterator socketIter;
+    for (socketIter = sockets.begin(); socketIter != sockets.end(); ++socketIter)
+    {
+        closesocket(socketIter->second);
+    }
+    delete packer;
+    delete scheduler;
+
+    /* free configuration */
+    delete dirCfg;
+    delete networkCfgs;
+    delete timerCfg;
+}
+
+int Controller::handle_signal(int signum, siginfo_t *, ucontext_t *)
+{
+    DWORD waitStatus;
+    waitStatus = WaitForMultipleObjects(1, &dirHandle, FALSE, INFINITE); 
+    if (waitStatus != WAIT_OBJECT_0)
+    {
+        return 0;
+    }
+    
+    string ok = string(dirCfg->GetXmlDir()) + string("\\ok");
+	while((ACE_OS::access(ok.c_str(), F_OK)) != 0)
+    {
+        Sleep(10);
+    }
+    
+    ReadDir(dirCfg->GetXmlDir());
+
+    ::FindNextChangeNotification(dirHandle);
+    return 0;
+}
+
+int Controller::handle_timeout(const ACE_Time_Value &currentTime,
+                               const void *act)
+{
+    if (act == nullptr)
+    {
+        /* snapshot timer, scheduled by ScheduleSnapshotSave() */
+        SaveSnapshot();
+        return 0;
+    }
+
+    /* timer wheel tick, the wheel is moved to current time, so a late tick does not 
+       delay the tables.
+     */
+    TimeMeter timeMeter;
+    timeMeter.Start();
+    uint64_t tick = (currentTime - wheelStartTime).msec() / timerCfg->GetTick();
+    list<TimerArg> expired;
+    timerWheel->Advance(tick, expired);
+
+    string pause = string(dirCfg->GetXmlDir()) + string("\\pause");
+    if (ACE_OS::access(pause.c_str(), F_OK) == 0)
+    {
+        return 0;
+    }
+
+    /* queue expired tables by deadline, low priority tables are stretched when the 
+       sender is overloaded.
+     */
+    set<NetId> netIds;
+    list<TimerArg>::iterator iter;
+    for (iter = expired.begin(); iter != expired.end(); ++iter)
+    {
+        netIds.insert(iter->netId);
+        if (overrunMonitor.Admit(iter->netId, iter->tableId, iter->lateness))
+        {
+            Pid pid = tableIdToPid.find(iter->tableId)->second;
+            scheduler->Push(iter->netId, pid, iter->tableId, tick - iter->lateness);
+        }
+    }
+
+    /* coalesce tables by network, the tables of a network which are due within the 
+       window are sent with the expired ones, so they are encoded together and leave in 
+       one sequence of datagrams.
+     */
+    uint64_t windowEnd = tick + timerCfg->GetWindow() / timerCfg->GetTick();
+    set<NetId>::iterator netIdIter;
+    for (netIdIter = netIds.begin(); netIdIter != netIds.end(); ++netIdIter)
+    {
+        map<TableId, Pid>::iterator tableIter;
+        for (tableIter = tableIdToPid.begin(); tableIter != tableIdToPid.end(); ++tableIter)
+        {
+            if (timerWheel->Expedite(*netIdIter, tableIter->first, windowEnd)
+                && overrunMonitor.Admit(*netIdIter, tableIter->first, 0))
+            {
+                scheduler->Push(*netIdIter, tableIter->second, tableIter->first, tick);
+            }
+        }
+    }
+
+    HandleBoundaries(tick);
+
+    /* tables within the bitrate budgets, earliest deadline first. */
+    list<TimerArg> due;
+    scheduler->Pop(tick, due);
+
+    map<NetId, list<TableId>> batches;
+    for (iter = due.begin(); iter != due.end(); ++iter)
+    {
+        batches[iter->netId].push_back(iter->tableId);
+    }
+
+    map<NetId, list<TableId>>::iterator batchIter;
+    for (batchIter = batches.begin(); batchIter != batches.end(); ++batchIter)
+    {
+        SendSiTables(batchIter->first, batchIter->second);
+    }
+    FlushDatagrams();
+
+    timeMeter.End();
+    if (overrunMonitor.AccountTick((uint_t)timeMeter.GetDuration().count(), timerCfg->GetTick()))
+    {
+        errstrm << "Sender load changed, " << overrunMonitor << endl;
+    }
+
+    if (tick >= reportTick)
+    {
+        ReportStatistics();
+        reportTick = tick + (uint64_t)ReportInterval * 1000 / timerCfg->GetTick();
+    }
+    
+    return 0;
+}
+
+#define TestReadXmlPerformance
+bool Controller::Start(ACE_Reactor *reactor, const char *xmlPath)
+{
+    error_code errCode;
+    /********* Step 1: Init Configuration *********/
+    /* dir configuration */
+    dirCfg = DirCfgInterface::CreateInstance(xmlPath);
+    
+    char *cfgDir = ACE_OS::getenv("EpgSenderData");    
+    if (cfgDir == nullptr)
+    {
+        errstrm << "Error when get environment variable of EpgSenderData" << endl;
+        return false;
+    }
+
+    /* networks configuration */
+    string receiverCfgPath = string(cfgDir) + string("\\receiver.xml");
+    networkCfgs = NetworkCfgsInterface::CreateInstance();
+    NetworkCfgWrapperInterface<NetworkCfgsInterface, NetworkCfgInterface, ReceiverInterface> networkCfgWrapper;
+    errCode = networkCfgWrapper.Select(*networkCfgs, receiverCfgPath.c_str());
+    if (errCode)
+    {
+        cout << "Error when reading " << receiverCfgPath << ", error message: " << errCode.message() << endl;
+        return false;
+    }
+
+    /* timer configuration */
+    string senderCfgPath = string(cfgDir) + string("\\sender.xml");
+    timerCfg = TimerCfgInterface::CreateInstance();
+    TimerCfgWrapperInterface<TimerCfgInterface> timerCfgWrapper;
+    errCode = timerCfgWrapper.Select(*timerCfg, senderCfgPath.c_str());
+    if (errCode)
+    {
+        errstrm << "Error when reading " << senderCfgPath << ", error message: " << errCode.message() << endl;
+        return false;
+    }
+
+    /********* Step 2: Init Reactor *********/
+    this->reactor (reactor);    
+
+    /********* Step 3: Setup Runtime Information *********/
+    /* this->tsPackets */
+    tsPackets = TransportPacketsInterface::CreateInstance();    
+
+    /* carousel scheduler, all table timers are in the timer wheel, the wheel is 
+       driven by one reactor timer.
+     */
+    timerWheel = new TimerWheel();    
+    wheelStartTime = ACE_OS::gettimeofday();
+    ACE_Time_Value tick;
+    tick.msec((long)timerCfg->GetTick());
+    wheelTimerId = reactor->schedule_timer(this, timerWheel, tick, tick);
+    packer = new DatagramPacker(timerCfg->GetDatagramSize());
+    scheduler = new CarouselScheduler(timerCfg);
+    SiTableInterface::SetEitSegmentation(timerCfg->GetEitSegmentation());
+    SiTableInterface::SetEitHorizon(timerCfg->GetEitHorizon());
+
+    /* snapshot of all xml files, tables are replayed from it instead of parsing xml files. */
+    snapshotPath = string(cfgDir) + string("\\snapshot.bin");
+    snapshot = new Snapshot();
+    if (!snapshot->Load(snapshotPath.c_str()))
+    {
+        cout << "No valid snapshot " << snapshotPath << ", reading all xml files." << endl;
+    }
+
+    /* version_number history of every sub_table, the version is increased only when the 
+       content is changed.
+     */
+    if (timerCfg->GetAutoVersion())
+    {
+        versionPath = string(cfgDir) + string("\\versions.bin");
+        versionRegistry = new VersionRegistry();
+        if (!versionRegistry->Load(versionPath.c_str()))
+        {
+            cout << "No valid version registry " << versionPath << ", using versions of xml files." << endl;
+        }
+    }
+
+#ifdef TestReadXmlPerformance
+    TimeMeter timeMeter;
+    timeMeter.Start();
+
+    ReadDir(dirCfg->GetXmlDir());
+
+    timeMeter.End();
+    cout << "elapsed time(milliseconds): " << timeMeter.GetDuration().count() << endl;
+#else
+    ReadDir(dirCfg->GetXmlDir());
+#endif
+
+    AddMonitoredDir(dirCfg->GetXmlDir());
+    //AddMonitoredDir(dirCfg->GetTsDir()); 
+    return true;
+}
+
+/* private function */
+void Controller::AnalyzeFileName(const char *path, NetId &netId, Pid &pid, string &type)
+{    
+   char drive[3];
+   char dir[PATH_MAX];
+   char fname[FILENAME_MAX];
+   char ext[FILENAME_MAX];
+   
+    _splitpath(path, drive, dir, fname, ext); 
+
+    char buffer[FILENAME_MAX];
+    char *start, *end;
+    size_t size;
+
+    /* Network Id */
+    start = fname;
+    end = strstr(fname, "_");
+    size = end - start;
+    memcpy(buffer, start, size);
+    buffer[size] = '\0';
+    netId = (NetId)strtol(buffer, nullptr, 0);
+
+    /* version */
+    start = end + 1;
+    end = strstr(start, "_");
+
+    /* nit|bat|sdt|eit */
+    start = end + 1;
+    end = strstr(start, "_");
+    size = end - start;
+    memcpy(buffer, start, size);
+    buffer[size] = '\0';
+    map<string, Pid>::iterator iter = tableNameToPid.find(buffer);
+    assert(iter != tableNameToPid.end());
+    pid = iter->second;
+    type = buffer;
+}
+
+void Controller::AddMonitoredDir(const char *directory)
+{
+    /* we can monitor one dir only. */
+    assert(dirHandle == ACE_INVALID_HANDLE);
+    int flags = FILE_NOTIFY_CHANGE_FILE_NAME;
+
+    dirHandle = ACE_TEXT_FindFirstChangeNotification(directory,  
+        FALSE, // flag for monitoring directory or directory tree
+        flags); // filter conditions to watch for        
+    assert(dirHandle != ACE_INVALID_HANDLE);
+    
+    int ret;
+    ret = this->reactor()->register_handler(this, dirHandle);
+    assert(ret == 0);
+}
+
+void Controller::AddSiTable(const char *path, uint64_t fileHash, const vector<string> &deled)
+{
+    NetId   netId;
+    Pid     pid;
+    string  type;
+    
+    AnalyzeFileName(path, netId, pid, type);    
+    
+    /* network relation */
+    NetworkRelationWrapperInterface<NetworkCfgsInterface> netRelationWrapper;
+    string relationXmlPath = string(dirCfg->GetXmlDir()) + string("\\NetWorkNode.xml");
+    error_code errCode = netRelationWrapper.Select(*networkCfgs, relationXmlPath.c_str());
+    if (errCode)
+    {
+        errstrm << "Error when reading " << relationXmlPath 
+             << ", error message: " << errCode.message() << endl;
+        return;
+    }
+        
+    /* Add SiSable to TsPacket */
+    TransportPacketInterface *tsPacket;
+    TransportPacketsInterface::iterator iter = tsPackets->Find(netId, pid);
+    if (iter == tsPackets->End())
+    {
+        tsPacket = TransportPacketInterface::CreateInstance(netId, pid);
+        tsPacket->SetSectionTiers(timerCfg->GetEitTiers());
+        tsPacket->SetSectionPacking(timerCfg->GetSectionPacking(pid));
+        tsPackets->Add(tsPacket);
+    }
+    else
+    {
+        tsPacket = *iter;
+    }
+
+    /* fileHash is 0 if the file can't be read, don't look up the snapshot. */
+    list<SiTableInterface*> siTables;
+    if (fileHash != 0 && snapshot->Replay(fileHash, siTables))
+    {
+        cout << "Reading " << path << " from snapshot" << endl;
+    }
+    else
+    {
+        typedef SiTableXmlWrapperRepository<SiTableRecorder> Repository;
+        typedef SiTableXmlWrapperInterface<SiTableRecorder> Wrapper;
+
+        Repository &repository = Repository::GetInstance();
+        Wrapper &siTableWrapper = repository.GetWrapperInstance(type);
+        list<SiTableRecorder*> recorders = siTableWrapper.Select(path);
+
+        vector<uchar_t> records;
+        list<SiTableRecorder*>::iterator recorderIter;
+        for (recorderIter = recorders.begin(); recorderIter != recorders.end(); ++recorderIter)
+        {
+            const vector<uchar_t> &tableRecords = (*recorderIter)->GetRecords();
+            records.insert(records.end(), tableRecords.begin(), tableRecords.end());
+            siTables.push_back((*recorderIter)->Release());
+            delete *recorderIter;
+        }
+
+        if (fileHash != 0)
+        {
+            snapshot->Add(fileHash, records);
+        }
+    }
+    
+    /* save {file name, table id, key list} relation ship */
+    FileSummary summary(path, netId, pid, fileHash);
+    list<SiTableInterface*>::iterator ii;
+    for (ii = siTables.begin(); ii != siTables.end(); ++ii)
+    {
+        TableId    tableId  = (*ii)->GetTableId();
+        SiTableKey tableKey = (*ii)->GetKey();
+        SiTableIdAndKey tableIdAndKey = FileSummary::AssembleTableIdAndKey(tableId, tableKey);
+        summary.tableIdAndKeys.push_back(tableIdAndKey);
+        
+        /* schedule timer for {NetId, TableId} */
+        IncreaseTableNumber(netId, tableId);
+
+        if (versionRegistry != nullptr)
+        {
+            (*ii)->SetVersion(versionRegistry->Assign(netId, **ii));
+        }
+
+        SiTableInterface *liveTable = tsPacket->FindSiTable(tableId, tableKey);
+        /* the fingerprint folds in the version of the xml file, the version may be changed
+           by the version registry or Inherit(), so the content and the version are compared.
+         */
+        if (liveTable != nullptr 
+            && liveTable->GetContentFingerprint() == (*ii)->GetContentFingerprint()
+            && liveTable->GetVersion() == (*ii)->GetVersion())
+        {
+            /* the live table is owned by the oldest summary which carries it (FindSiTable()
+               returns the oldest table of the key). 
+             */
+            list<FileSummary>::iterator summaryIter;
+            list<SiTableIdAndKey>::iterator keyIter;
+            for (summaryIter = fileSummaries.begin(); summaryIter != fileSummaries.end(); ++summaryIter)
+            {
+                if (summaryIter->netId != netId || summaryIter->pid != pid)
+                    continue;
+
+                keyIter = find(summaryIter->tableIdAndKeys.begin(), summaryIter->tableIdAndKeys.end(), tableIdAndKey);
+                if (keyIter != summaryIter->tableIdAndKeys.end())
+                    break;
+            }
+
+            /* an identical table is on air already and its file is being replaced, keep it
+               (and its catches). the new file takes over the ownership, so deleting the old
+               file will not delete it.  a file which stays keeps its own table.
+             */
+            if (summaryIter != fileSummaries.end()
+                && binary_search(deled.begin(), deled.end(), summaryIter->fileName))
+            {
+                summaryIter->tableIdAndKeys.erase(keyIter);
+                DecreaseTableNumber(netId, tableId);
+                delete *ii;
+                continue;
+            }
+        }
+
+        if (liveTable != nullptr)
+        {
+            /* the table replaces the live one, codes of unchanged sections are reused. */
+            (*ii)->Inherit(*liveTable);
+            if (versionRegistry != nullptr)
+            {
+                /* the registry keeps the version which is on air. */
+                versionRegistry->Update(netId, **ii);
+            }
+        }
+        tsPacket->AddSiTable(*ii);
+    }
+    fileSummaries.push_back(move(summary));
+
+    if (pid == EitPid)
+    {
+        ScheduleBoundary(netId);
+    }
+}
+
+void Controller::DelSiTable(const char *path)
+{
+    NetId   netId;
+    Pid     pid;
+    string  type;
+    cout << "Removing " << path << endl;
+    AnalyzeFileName(path, netId, pid, type);   
+
+    TransportPacketsInterface::iterator iter = tsPackets->Find(netId, pid);
+    assert(iter != tsPackets->End());
+    TransportPacketInterface *tsPacket = *iter;
+
+    std::list<FileSummary>::iterator summaryIter;
+    summaryIter = find_if(fileSummaries.begin(), fileSummaries.end(), CompareSummaryFileName(path));
+    assert (summaryIter != fileSummaries.end());
+    list<SiTableIdAndKey>::iterator ii;
+    for (ii = summaryIter->tableIdAndKeys.begin(); ii != summaryIter->tableIdAndKeys.end(); ++ii)
+    {
+        TableId tableId = FileSummary::GetTableId(*ii);
+        SiTableKey tableKey = FileSummary::GetTableKey(*ii);
+
+        tsPacket->DelSiTable(tableId, tableKey);
+        if (versionRegistry != nullptr && tsPacket->FindSiTable(tableId, tableKey) == nullptr)
+        {
+            /* no other file carries the sub_table, it is gone from air. */
+            versionRegistry->Remove(netId, tableId, tableKey);
+        }
+        /* cancel timer of {NetId, TableId} if it is the last one */
+        DecreaseTableNumber(netId, tableId);
+    }
+    fileSummaries.remove_if(CompareSummaryFileName(path));
+
+    if (pid == EitPid)
+    {
+        ScheduleBoundary(netId);
+    }
+}
+
+bool Controller::CalculateFileHash(const char *path, uint64_t &fileHash)
+{
+    ifstream file(path, ios::in | ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    vector<char> content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    fileHash = XxHash::CalculateHash((const uchar_t*)content.data(), content.size());
+    return true;
+}
+
+void Controller::ReadDir(const char *dir)
+{    
+    list<string> newPathes, oldPathes;
+    
+	ACE_DIR *aceDir = ACE_OS::opendir(dir);
+	assert(aceDir != nullptr);
+	while (ACE_DIRENT *entry = ACE_OS::readdir(aceDir))
+	{
+		if (regex_match(entry->d_name, regex(".*(nit|bat|sdt|eit).*\\.xml")))
+        {
+            newPathes.push_back(string(dir) + string("\\") + string(entry->d_name));
+        }
+	}
+	ACE_OS::closedir(aceDir);
+
+    list<FileSummary>::iterator summeryIter;
+    for (summeryIter = fileSummaries.begin(); summeryIter != fileSummaries.end(); ++summeryIter)
+    {
+        oldPathes.push_back(summeryIter->fileName);
+    }
+
+    vector<string> added, deled;
+    
+    newPathes.sort();
+    oldPathes.sort();
+    set_difference(newPathes.begin(), newPathes.end(), 
+                   oldPathes.begin(), oldPathes.end(), 
+                   std::back_inserter(added));
+    set_difference(oldPathes.begin(), oldPathes.end(), 
+                   newPathes.begin(), newPathes.end(), 
+                   std::back_inserter(deled));
+
+    for (vector<string>::iterator iter = added.begin(); iter != added.end(); ++iter)
+    {
+        NetId   netId;
+        Pid     pid;
+        string  type;
+        uint64_t fileHash = 0;
+
+        AnalyzeFileName(iter->c_str(), netId, pid, type);
+        if (CalculateFileHash(iter->c_str(), fileHash))
+        {
+            /* upstream re-exports unchanged xml file with a new name, if the content is 
+               same as a deleted file, just rename the summary, the tables keep on air.
+             */
+            list<FileSummary>::iterator summaryIter;
+            for (summaryIter = fileSummaries.begin(); summaryIter != fileSummaries.end(); ++summaryIter)
+            {
+                if (summaryIter->netId == netId && summaryIter->pid == pid 
+                    && summaryIter->fileHash == fileHash
+                    && binary_search(deled.begin(), deled.end(), summaryIter->fileName))
+                {
+                    break;
+                }
+            }
+
+            if (summaryIter != fileSummaries.end())
+            {
+                cout << "Renaming " << summaryIter->fileName << " to " << *iter << endl;
+                deled.erase(lower_bound(deled.begin(), deled.end(), summaryIter->fileName));
+                summaryIter->fileName = *iter;
+                continue;
+            }
+        }
+
+        AddSiTable(iter->c_str(), fileHash, deled);
+    }
+
+    for (vector<string>::iterator iter = deled.begin(); iter != deled.end(); ++iter)
+    {
+        DelSiTable(iter->c_str());
+    }
+
+    if (!added.empty() || !deled.empty())
+    {
+        ScheduleSnapshotSave();
+    }
+}
+
+void Controller::SaveSnapshot()
+{
+    set<uint64_t> fileHashes;
+    list<FileSummary>::iterator iter;
+    for (iter = fileSummaries.begin(); iter != fileSummaries.end(); ++iter)
+    {
+        fileHashes.insert(iter->fileHash);
+    }
+
+    snapshot->Save(snapshotPath.c_str(), fileHashes);
+    if (versionRegistry != nullptr && versionRegistry->IsDirty())
+    {
+        versionRegistry->Save(versionPath.c_str());
+    }
+    snapshotTimerId = -1;
+}
+
+void Controller::ScheduleSnapshotSave()
+{
+    /* write snapshot file later in reactor, several changes are written together, 
+       and sending tables is not delayed by writting the file. 
+     */
+    if (snapshotTimerId == -1)
+    {
+        ACE_Time_Value delay(SnapshotSaveDelay);
+        snapshotTimerId = this->reactor()->schedule_timer(this, nullptr, delay);
+    }
+}
+
+void Controller::SendSiTables(NetId netId, const list<TableId> &tableIds)
+{
+    /* {ts packet, table id} of the batch, catches are refreshed by HandleBoundaries(). */
+    SendingTables tables;
+    list<TableId>::const_iterator iter;
+    for (iter = tableIds.begin(); iter != tableIds.end(); ++iter)
+    {
+        Pid pid = tableIdToPid.find(*iter)->second;
+        TransportPacketsInterface::iterator tsPacketIter = tsPackets->Find(netId, pid);
+        if (tsPacketIter == tsPackets->End())
+        {
+            /* timers are cancelled with the last table, this should never happen. */
+            errstrm << "No ts packet for netId " << netId << ", table id " << (uint_t)*iter << endl;
+            timerWheel->Delete(netId, *iter);
+            continue;
+        }
+
+        (*tsPacketIter)->NextRound(*iter);
+        tables.push_back(make_pair(*tsPacketIter, *iter));
+    }
+
+    if (tables.empty())
+    {
+        return;
+    }
+
+    vector<size_t> sizes(tables.size(), 0);
+    NetworkCfgsInterface::iterator networkIter;
+    for (networkIter = networkCfgs->Begin(); networkIter != networkCfgs->End(); ++networkIter)
+    {
+        NetworkCfgInterface *network = *networkIter;
+        if (!networkCfgs->IsChildNetwork(netId, network->GetNetId()))
+        {
+            continue;
+        }
+        
+        SendUdp(network, tables, sizes);
+    }   
+
+    /* the intervals are stretched if the tables outgrow the bitrate budgets. */
+    bool changed = false;
+    for (size_t i = 0; i < tables.size(); ++i)
+    {
+        Pid pid = tables[i].first->GetPid();
+        changed = scheduler->SetSize(netId, pid, tables[i].second, sizes[i]) || changed;
+    }
+
+    if (changed)
+    {
+        SetIntervals(netId);
+    }
+}
+
+void Controller::SendUdp(NetworkCfgInterface *network, const SendingTables &tables, 
+                         vector<size_t> &sizes)
+{
+    NetworkCfgInterface::iterator receiverIter;
+    for (receiverIter =  network->Begin(); 
+         receiverIter != network->End(); 
+         ++receiverIter)
+    {
+        ReceiverInterface *receiver = *receiverIter;
+        ReceiverId receiverId = receiver->GetReceiverId();
+        TsId tsId = receiver->GetTsId();
+
+        /* the tables are encoded into the receiver's pending packets, they are sent 
+           in full datagrams by FlushDatagrams() at the end of the tick.
+         */
+        for (size_t i = 0; i < tables.size(); ++i)
+        {
+            TransportPacketInterface *tsPacket = tables[i].first;
+            TableId tableId = tables[i].second;
+            if (receiverIter != network->Begin())
+            {
+                /* bat and nit will only be sent to center frequency. */
+                if (tableId == BatTableId 
+                    || tableId == NitActualTableId || tableId == NitOtherTableId)
+                {
+                    continue;
+                }
+            }
+
+            size_t size = tsPacket->GetCodesSize(tableId, tsId); 
+            sizes[i] = std::max(sizes[i], size);
+            if (size == 0)
+            {
+                continue;
+            }
+
+            uchar_t *buffer = packer->Allocate(network, receiver, size);
+            /* ReceiverId is is unique for every receiver, 
+               So we use ReceiverId as ccId index.
+             */
+            tsPacket->MakeCodes((CcId)receiverId, tableId, tsId, buffer, size);
+            ReceiverInterface::iterator pidMapIter;
+            for (pidMapIter = receiver->Begin(); pidMapIter != receiver->End(); ++pidMapIter)
+            {
+                tsPacket->MapPid(buffer, size, pidMapIter->first, pidMapIter->second);
+            }
+        }
+    }    
+}
+
+void Controller::FlushDatagrams()
+{
+    packer->Flush([this](NetworkCfgInterface *network, ReceiverInterface *receiver, 
+                         const uchar_t *datagram, size_t size)
+    {
+        int socketFd = this->GetSocket(network);
+        if (socketFd == INVALID_SOCKET)
+        {
+            return;
+        }
+
+        struct sockaddr_in dstAddr = receiver->GetDstAddr();
+        sendto(socketFd, (const char*)datagram, (int)size, 0, 
+               (SOCKADDR *)&dstAddr, 
+               sizeof(struct sockaddr_in));
+    });
+}
+
+int Controller::GetSocket(NetworkCfgInterface *network)
+{
+    map<NetworkCfgInterface*, int>::iterator iter = sockets.find(network);
+    if (iter != sockets.end())
+    {
+        return iter->second;
+    }
+
+    int socketFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (socketFd == INVALID_SOCKET)
+    {
+        errstrm << "Error when create socket." << endl;
+        return socketFd;
+    }
+
+    /* multicast packets leave from the network's source address, the option is set only
+       if the network has a multicast receiver.  the failure is reported once and is not 
+       fatal, unicast receivers of the network are still served by the socket.
+     */
+    NetworkCfgInterface::iterator receiverIter;
+    for (receiverIter = network->Begin(); receiverIter != network->End(); ++receiverIter)
+    {
+        struct sockaddr_in dstAddr = (*receiverIter)->GetDstAddr();
+        uchar_t bt = dstAddr.sin_addr.S_un.S_un_b.s_b1;
+        if (bt >= 224 && bt <= 239)
+        {
+            struct in_addr srcAddr = network->GetSrcAddr();
+            if(setsockopt(socketFd, IPPROTO_IP, IP_MULTICAST_IF, 
+                          (char *)&srcAddr, sizeof(srcAddr)) < 0)
+            {
+                errstrm << "Error when set socket option of network " << network->GetNetId() << endl;
+            }
+            break;
+        }
+    }
+
+    sockets.insert(make_pair(network, socketFd));
+    return socketFd;
+}
+
+void Controller::ScheduleTimer(NetId netId, TableId tableId)
+{
+    if (timerWheel->Find(netId, tableId))
+    {
+        return;
+    }
+
+    uint_t interval = GetIntervalTicks(netId, tableId);
+
+    /* phase stagger, spread the first firing of timers over the interval, so the 
+       repetition bursts of different networks and tables are not aligned.
+     */
+    uint32_t key = ((uint32_t)netId << 8) | tableId;
+    uint64_t hash = XxHash::CalculateHash((const uchar_t*)&key, sizeof(key));
+    uint_t delay = (uint_t)(hash % interval * timerCfg->GetStagger() / 100);
+
+    timerWheel->Add(netId, tableId, delay, interval);
+}
+
+uint_t Controller::GetIntervalTicks(NetId netId, TableId tableId) const
+{
+    uint_t interval = scheduler->GetInterval(netId, tableId) / timerCfg->GetTick();
+    return std::max(interval, (uint_t)1);
+}
+
+void Controller::SetIntervals(NetId netId)
+{
+    map<TableId, Pid>::iterator tableIter;
+    for (tableIter = tableIdToPid.begin(); tableIter != tableIdToPid.end(); ++tableIter)
+    {
+        timerWheel->SetInterval(netId, tableIter->first, GetIntervalTicks(netId, tableIter->first));
+    }
+}
+
+void Controller::IncreaseTableNumber(NetId netId, TableId tableId)
+{
+    uint32_t key = ((uint32_t)netId << 8) | tableId;
+    if (++tableNumbers[key] == 1)
+    {
+        UpdateTimer(netId, tableId);
+    }
+}
+
+void Controller::DecreaseTableNumber(NetId netId, TableId tableId)
+{
+    uint32_t key = ((uint32_t)netId << 8) | tableId;
+    map<uint32_t, size_t>::iterator iter = tableNumbers.find(key);
+    assert(iter != tableNumbers.end() && iter->second != 0);
+    if (--iter->second == 0)
+    {
+        tableNumbers.erase(iter);
+        UpdateTimer(netId, tableId);
+    }
+}
+
+bool Controller::IsTableOnAir(NetId netId, TableId tableId) const
+{
+    uint32_t key = ((uint32_t)netId << 8) | tableId;
+    if (tableNumbers.find(key) != tableNumbers.end())
+    {
+        return true;
+    }
+
+    /* present/following tables are made of schedule tables. */
+    if (tableId == EitActualPfTableId)
+    {
+        return IsTableOnAir(netId, EitActualSchTableId);
+    }
+    if (tableId == EitOtherPfTableId)
+    {
+        return IsTableOnAir(netId, EitOtherSchTableId);
+    }
+    return false;
+}
+
+void Controller::UpdateTimer(NetId netId, TableId tableId)
+{
+    if (IsTableOnAir(netId, tableId))
+    {
+        ScheduleTimer(netId, tableId);
+    }
+    else
+    {
+        timerWheel->Delete(netId, tableId);
+        /* the deleted table doesn't load the bitrate budgets any more. */
+        if (scheduler->Remove(netId, tableId))
+        {
+            SetIntervals(netId);
+        }
+    }
+
+    if (tableId == EitActualSchTableId)
+    {
+        UpdateTimer(netId, EitActualPfTableId);
+    }
+    else if (tableId == EitOtherSchTableId)
+    {
+        UpdateTimer(netId, EitOtherPfTableId);
+    }
+}
+
+void Controller::HandleBoundaries(uint64_t tick)
+{
+    /* only the earliest boundary is checked every tick. */
+    time_t now = time(nullptr);
+    while (!boundaries.empty() && boundaries.begin()->first <= now)
+    {
+        NetId netId = boundaries.begin()->second;
+        boundaries.erase(boundaries.begin());
+        netBoundaries.erase(netId);
+
+        TransportPacketsInterface::iterator tsPacketIter = tsPackets->Find(netId, EitPid);
+        if (tsPacketIter == tsPackets->End())
+        {
+            continue;
+        }
+
+        /* the prepared p/f sections are swapped in, send them now instead of waiting for 
+           the p/f timer.
+         */
+        (*tsPacketIter)->RefreshCatch();
+        TableId pfTableIds[] = {EitActualPfTableId, EitOtherPfTableId};
+        for (size_t i = 0; i < sizeof(pfTableIds) / sizeof(pfTableIds[0]); ++i)
+        {
+            if (IsTableOnAir(netId, pfTableIds[i]))
+            {
+                scheduler->Push(netId, EitPid, pfTableIds[i], tick);
+            }
+        }
+        ScheduleBoundary(netId);
+    }
+}
+
+void Controller::ReportStatistics() const
+{
+    cout << "Shared sections: ";
+    SiTableInterface::PutSectionStore(cout);
+    cout << endl;
+    cout << "Shared models: " << SiTableInterface::GetModelNumber() << endl;
+
+
+    TransportPacketsInterface::iterator iter;
+    for (iter = tsPackets->Begin(); iter != tsPackets->End(); ++iter)
+    {
+        uint64_t packetNumber = (*iter)->GetPacketNumber();
+        uint64_t savedNumber = (*iter)->GetSavedPacketNumber();
+        if (!timerCfg->GetSectionPacking((*iter)->GetPid()) || packetNumber == 0)
+        {
+            continue;
+        }
+
+        /* saved bandwidth in percent of the bandwidth without packing. */
+        cout << "Section packing of network " << (*iter)->GetNetId() << ", pid " << (*iter)->GetPid()
+             << ": sent " << packetNumber << " ts packets, saved " << savedNumber << " ts packets ("
+             << savedNumber * 100 / (packetNumber + savedNumber) << "%)" << endl;
+    }
+}
+
+void Controller::ScheduleBoundary(NetId netId)
+{
+    map<NetId, time_t>::iterator iter = netBoundaries.find(netId);
+    if (iter != netBoundaries.end())
+    {
+        boundaries.erase(make_pair(iter->second, netId));
+        netBoundaries.erase(iter);
+    }
+
+    TransportPacketsInterface::iterator tsPacketIter = tsPackets->Find(netId, EitPid);
+    if (tsPacketIter == tsPackets->End())
+    {
+        return;
+    }
+
+    time_t boundary = (*tsPacketIter)->GetNextBoundary();
+    if (boundary != 0)
+    {
+        boundaries.insert(make_pair(boundary, netId));
+        netBoundaries.insert(make_pair(netId, boundary));
+    }
+}
+
+#pragma warning(pop)
@@ -1,108 +1,168 @@
-#ifndef _Controller_h_
-#define _Controller_h_
-
-/* Configuration */
-#include "Include/Configuration/TimerCfgInterface.h"
-#include "Include/Configuration/DirCfgInterface.h"
-#include "Include/Configuration/NetworkCfgInterface.h"
-
-/* Controller */
-#include "Include/Controller/ControllerInterface.h"
-#include "TimerRepository.h"
-
-/**********************class FileSummary**********************/
-struct FileSummary
-{
-    FileSummary(const std::string &fileName)
-        : fileName(fileName)
-    {}
-
-    FileSummary(FileSummary &&value)
-    {
-        fileName = move(value.fileName);
-        tableIdAndKeys = move(value.tableIdAndKeys);
-    }
-
-    static SiTableIdAndKey AssembleTableIdAndKey(TableId tableId, SiTableKey tableKey)
-    {
-        return ((SiTableIdAndKey)tableId << SiTableKeyBits) | ((SiTableIdAndKey)tableKey & MaxSiTableKey);
-    }
-
-    static TableId GetTableId(SiTableIdAndKey tableIdAndKey)
-    {
-        return (TableId)(tableIdAndKey >> SiTableKeyBits);
-    }
-    
-    static SiTableKey GetTableKey(SiTableIdAndKey tableIdAndKey)
-    {
-        return (SiTableKey)(tableIdAndKey & MaxSiTableKey);
-    }
-
-    std::string              fileName;
-    std::list<SiTableIdAndKey> tableIdAndKeys;
-};
-
-class CompareSummaryFileName: public std::unary_function<FileSummary, bool>
-{
-public:
-    CompareSummaryFileName(const char *fileName)
-        : fileName(fileName)
-    {}
-
-    result_type operator()(const argument_type &summary)
-    {
-        return (result_type)(summary.fileName == fileName);
-    }    
-
-    result_type operator()(const argument_type *summary)
-    {
-        return this->operator()(*summary);
-    }
-
-private:
-    std::string fileName;
-};
-
-/**********************class Controller**********************/
-class Controller: public ControllerInterface
-{
-public:
-    Controller();
-    ~Controller();
-
-    int handle_signal(int signum, siginfo_t *, ucontext_t *);
-    int handle_timeout(const ACE_Time_Value &currentTime, const void *act);
-    bool Start(ACE_Reactor *reactor, const char *cfgPath);
-
-private:
-    void AddMonitoredDir(const char *directory);
-    
-    /* name rule:  netId_version_[nit|bat|sdt|eit]_index_year-month-day-hour-minuts-seconds.xml
-    example: 201_004_nit_1_2015-12-15-10-34-01.xml 
-    */
-    void AnalyzeFileName(const char *path, NetId &netId, Pid &pid, std::string &type);
-    void AddSiTable(const char *path);
-    void DelSiTable(const char *path);
-    void ReadDir(const char *dir);
-
-    void SendUdp(NetworkCfgInterface *network, TransportPacketInterface *tsPacket, TableId tableId);
-    void ScheduleTimer(NetId netId, TableId tableId);
-
-private:
-    /* const data member */
-    std::map<TableId, Pid>     tableIdToPid;
-    std::map<std::string, Pid> tableNameToPid;
-
-    /* configuration */
-    DirCfgInterface *dirCfg;
-    NetworkCfgsInterface *networkCfgs;
-    TimerCfgInterface *timerCfg;
-
-    /* runtime information */
-    TransportPacketsInterface *tsPackets;    //modified by AddSiTable(), tsPackets->Add(tsPacket)
-    TimerRepository *timerRepository; //modified by AddSiTable(), timerRepository->Add(timerId, timerArg);
-    std::list<FileSummary>  fileSummaries; //modified by AddSiTable(), fileSummaries.push_back(fileSummary);
-    ACE_HANDLE dirHandle;      //monitored dir handle, modified by AddMonitoredDir()
-};
-
+#ifndef _Controller_h_
+#define _Controller_h_
+
+/* Configuration */
+#include "Include/Configuration/TimerCfgInterface.h"
+#include "Include/Configuration/DirCfgInterface.h"
+#include "Include/Configuration/NetworkCfgInterface.h"
+
+/* Controller */
+#include "Include/Controller/ControllerInterface.h"
+#include "TimerWheel.h"
+#include "Snapshot.h"
+#include "VersionRegistry.h"
+#include "DatagramPacker.h"
+#include "OverrunMonitor.h"
+#include "CarouselScheduler.h"
+
+/**********************class FileSummary**********************/
+struct FileSummary
+{
+    FileSummary(const std::string &fileName, NetId netId, Pid pid, uint64_t fileHash)
+        : fileName(fileName), netId(netId), pid(pid), fileHash(fileHash)
+    {}
+
+    FileSummary(FileSummary &&value)
+    {
+        fileName = move(value.fileName);
+        netId = value.netId;
+        pid = value.pid;
+        fileHash = value.fileHash;
+        tableIdAndKeys = move(value.tableIdAndKeys);
+    }
+
+    static SiTableIdAndKey AssembleTableIdAndKey(TableId tableId, SiTableKey tableKey)
+    {
+        return ((SiTableIdAndKey)tableId << SiTableKeyBits) | ((SiTableIdAndKey)tableKey & MaxSiTableKey);
+    }
+
+    static TableId GetTableId(SiTableIdAndKey tableIdAndKey)
+    {
+        return (TableId)(tableIdAndKey >> SiTableKeyBits);
+    }
+    
+    static SiTableKey GetTableKey(SiTableIdAndKey tableIdAndKey)
+    {
+        return (SiTableKey)(tableIdAndKey & MaxSiTableKey);
+    }
+
+    std::string              fileName;
+    NetId                    netId;
+    Pid                      pid;
+    uint64_t                 fileHash;  //XxHash of the xml file content.
+    std::list<SiTableIdAndKey> tableIdAndKeys;
+};
+
+class CompareSummaryFileName: public std::unary_function<FileSummary, bool>
+{
+public:
+    CompareSummaryFileName(const char *fileName)
+        : fileName(fileName)
+    {}
+
+    result_type operator()(const argument_type &summary)
+    {
+        return (result_type)(summary.fileName == fileName);
+    }    
+
+    result_type operator()(const argument_type *summary)
+    {
+        return this->operator()(*summary);
+    }
+
+private:
+    std::string fileName;
+};
+
+/**********************class Controller**********************/
+class Controller: public ControllerInterface
+{
+public:
+    Controller();
+    ~Controller();
+
+    int handle_signal(int signum, siginfo_t *, ucontext_t *);
+    int handle_timeout(const ACE_Time_Value &currentTime, const void *act);
+    bool Start(ACE_Reactor *reactor, const char *cfgPath);
+
+private:
+    void AddMonitoredDir(const char *directory);
+    
+    /* name rule:  netId_version_[nit|bat|sdt|eit]_index_year-month-day-hour-minuts-seconds.xml
+    example: 201_004_nit_1_2015-12-15-10-34-01.xml 
+    */
+    void AnalyzeFileName(const char *path, NetId &netId, Pid &pid, std::string &type);
+    /* deled: sorted files which are going to be deleted in this scan. */
+    void AddSiTable(const char *path, uint64_t fileHash, const std::vector<std::string> &deled);
+    bool CalculateFileHash(const char *path, uint64_t &fileHash);
+    void DelSiTable(const char *path);
+    void ReadDir(const char *dir);
+    void SaveSnapshot();
+    void ScheduleSnapshotSave();
+
+    typedef std::vector<std::pair<TransportPacketInterface*, TableId>> SendingTables;
+    void SendSiTables(NetId netId, const std::list<TableId> &tableIds);
+    /* sizes[i] is set to the max encoded size of tables[i] of all receivers. */
+    void SendUdp(NetworkCfgInterface *network, const SendingTables &tables, std::vector<size_t> &sizes);
+    void FlushDatagrams();
+    int  GetSocket(NetworkCfgInterface *network);
+    void ScheduleTimer(NetId netId, TableId tableId);
+    uint_t GetIntervalTicks(NetId netId, TableId tableId) const;
+    /* set the stretched intervals of all timers of netId. */
+    void SetIntervals(NetId netId);
+
+    /* table number of {NetId, TableId}, the timer of {NetId, TableId} is scheduled when 
+       the first table appears, and is cancelled when the last table disappears.
+     */
+    void IncreaseTableNumber(NetId netId, TableId tableId);
+    void DecreaseTableNumber(NetId netId, TableId tableId);
+    bool IsTableOnAir(NetId netId, TableId tableId) const;
+    void UpdateTimer(NetId netId, TableId tableId);
+
+    /* eit event boundaries, the eit tables of a network are refreshed when the present 
+       event ends, and the new p/f is sent in the same tick.
+     */
+    void HandleBoundaries(uint64_t tick);
+    void ScheduleBoundary(NetId netId);
+    /* print the sections kept by the shared section store, and the ts packets saved by
+       section packing of every packed pid.
+     */
+    void ReportStatistics() const;
+
+private:
+    /* const data member */
+    std::map<TableId, Pid>     tableIdToPid;
+    std::map<std::string, Pid> tableNameToPid;
+
+    /* configuration */
+    DirCfgInterface *dirCfg;
+    NetworkCfgsInterface *networkCfgs;
+    TimerCfgInterface *timerCfg;
+
+    /* runtime information */
+    TransportPacketsInterface *tsPackets;    //modified by AddSiTable(), tsPackets->Add(tsPacket)
+    TimerWheel *timerWheel;    //modified by AddSiTable(), timerWheel->Add(netId, tableId, ...);
+    TimerId    wheelTimerId;   //reactor timer which drives timerWheel.
+    ACE_Time_Value wheelStartTime; //time of tick 0.
+    std::list<FileSummary>  fileSummaries; //modified by AddSiTable(), fileSummaries.push_back(fileSummary);
+    std::map<uint32_t, size_t> tableNumbers; //{NetId, TableId} -> number of table keys in fileSummaries.
+    ACE_HANDLE dirHandle;      //monitored dir handle, modified by AddMonitoredDir()
+    DatagramPacker *packer;    //ts packets of every receiver in current tick.
+    OverrunMonitor overrunMonitor; //deadline overrun accounting and load shedding.
+    CarouselScheduler *scheduler;  //earliest-deadline-first queue with bitrate budgets.
+    std::map<NetworkCfgInterface*, int> sockets; //udp socket of every network, modified by GetSocket()
+    std::set<std::pair<time_t, NetId>> boundaries; //{time, NetId} of next eit event boundary.
+    std::map<NetId, time_t> netBoundaries;         //NetId -> time in boundaries.
+    uint64_t reportTick;                           //tick of next ReportStatistics().
+
+    /* snapshot */
+    Snapshot    *snapshot;     //records of every xml file, modified by AddSiTable()
+    std::string snapshotPath;
+    TimerId     snapshotTimerId; //-1 if no pending snapshot writing.
+
+    /* version registry, written together with snapshot */
+    VersionRegistry *versionRegistry; //nullptr if versions of xml files are used.
+    std::string versionPath;
+};
+
 #endif
\ No newline at end of file
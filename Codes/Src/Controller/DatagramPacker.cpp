@@ -0,0 +1,73 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+
+/* Configuration */
+#include "Include/Configuration/NetworkCfgInterface.h"
+
+/* Controller */
+#include "DatagramPacker.h"
+using namespace std;
+
+/**********************class DatagramPacker**********************/
+/* public function */
+DatagramPacker::DatagramPacker(size_t packetNumber)
+    : packetNumber(packetNumber), datagramNumber(0), tsPacketNumber(0)
+{
+    assert(packetNumber != 0 && packetNumber <= MaxDatagramPacketNumber);
+}
+
+DatagramPacker::~DatagramPacker()
+{
+}
+
+uchar_t * DatagramPacker::Allocate(NetworkCfgInterface *network, ReceiverInterface *receiver,
+                                   size_t size)
+{
+    assert(size % TsPacketSize == 0);
+
+    ReceiverId receiverId = receiver->GetReceiverId();
+    Datagrams &datagrams = receivers[receiverId];
+    datagrams.network = network;
+    datagrams.receiver = receiver;
+
+    size_t offset = datagrams.packets.size();
+    datagrams.packets.resize(offset + size);
+    return datagrams.packets.data() + offset;
+}
+
+uint64_t DatagramPacker::GetDatagramNumber() const
+{
+    return datagramNumber;
+}
+
+uint64_t DatagramPacker::GetPacketNumber() const
+{
+    return tsPacketNumber;
+}
+
+size_t DatagramPacker::GetPacketNumberPerDatagram() const
+{
+    return packetNumber;
+}
+
+/* private function */
+void DatagramPacker::StampContinuityCounter(ReceiverId receiverId, uchar_t *packets, size_t size)
+{
+    for (uchar_t *ptr = packets; ptr < packets + size; ptr = ptr + TsPacketSize)
+    {
+        Pid pid = ((ptr[1] << 8) | ptr[2]) & MaxPid;
+        /* adaptation_field_control, the counter is not incremented for packets without payload. */
+        if ((ptr[3] & 0x10) == 0)
+        {
+            continue;
+        }
+
+        uint64_t key = ((uint64_t)receiverId << 16) | pid;
+        uchar_t &counter = continuityCounters[key];
+        ptr[3] = (ptr[3] & 0xF0) | counter;
+        counter = (counter + 1) & 0xF;
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef _DatagramPacker_h_
+#define _DatagramPacker_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+class NetworkCfgInterface;
+class ReceiverInterface;
+
+#define MaxDatagramPacketNumber (MaxUdpPayloadSize / TsPacketSize)
+
+/**********************class DatagramPacker**********************/
+/* collect ts packets of all tables due for a receiver in one tick, then send them in full
+   datagrams, tables of different network id and pid share datagrams. the continuity
+   counter of every packet is stamped again per {receiver, output pid}, so the counters
+   are continuous even if the packets come from different TransportPacket.
+   Example:
+    DatagramPacker packer(7);
+    uchar_t *buffer = packer.Allocate(network, receiver, size);
+    tsPacket->MakeCodes(ccId, tableId, tsId, buffer, size);
+    ...
+    packer.Flush([](NetworkCfgInterface *network, ReceiverInterface *receiver,
+                    const uchar_t *datagram, size_t size)
+    {
+        sendto(...);
+    });
+ */
+class DatagramPacker
+{
+public:
+    DatagramPacker(size_t packetNumber);
+    ~DatagramPacker();
+
+    /* return a buffer of "size" bytes at the end of the receiver's pending packets. the
+       buffer is valid until next Allocate() or Flush().
+     */
+    uchar_t * Allocate(NetworkCfgInterface *network, ReceiverInterface *receiver, size_t size);
+    /* call sender(network, receiver, datagram, size) for every datagram, only the last
+       datagram of a receiver may be partial.
+     */
+    template <typename Sender>
+    void Flush(Sender sender);
+
+    uint64_t GetDatagramNumber() const;
+    uint64_t GetPacketNumber() const;
+    size_t   GetPacketNumberPerDatagram() const;
+
+private:
+    struct Datagrams
+    {
+        NetworkCfgInterface *network;
+        ReceiverInterface   *receiver;
+        std::vector<uchar_t> packets;
+    };
+
+    void StampContinuityCounter(ReceiverId receiverId, uchar_t *packets, size_t size);
+
+private:
+    size_t packetNumber;    //ts packet number per datagram.
+    std::map<ReceiverId, Datagrams> receivers;
+    std::unordered_map<uint64_t, uchar_t> continuityCounters; //{ReceiverId, Pid} -> counter
+    uint64_t datagramNumber;    //number of sent datagrams.
+    uint64_t tsPacketNumber;    //number of sent ts packets.
+};
+
+template <typename Sender>
+void DatagramPacker::Flush(Sender sender)
+{
+    size_t datagramSize = packetNumber * TsPacketSize;
+    std::map<ReceiverId, Datagrams>::iterator iter;
+    for (iter = receivers.begin(); iter != receivers.end(); ++iter)
+    {
+        std::vector<uchar_t> &packets = iter->second.packets;
+        if (packets.empty())
+        {
+            continue;
+        }
+
+        StampContinuityCounter(iter->first, packets.data(), packets.size());
+        for (size_t offset = 0; offset < packets.size(); offset = offset + datagramSize)
+        {
+            size_t size = std::min(datagramSize, packets.size() - offset);
+            sender(iter->second.network, iter->second.receiver, packets.data() + offset, size);
+            ++datagramNumber;
+        }
+        tsPacketNumber = tsPacketNumber + packets.size() / TsPacketSize;
+
+        /* keep the capacity for next tick. */
+        packets.clear();
+    }
+}
+
+#endif
@@ -0,0 +1,154 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+
+/* Controller */
+#include "OverrunMonitor.h"
+using namespace std;
+
+/* lowest priority first. */
+static const TableId SheddingOrder[] =
+{
+    EitOtherSchTableId, EitActualSchTableId, SdtOtherTableId, BatTableId, NitOtherTableId
+};
+#define MaxDegradationLevel (sizeof(SheddingOrder) / sizeof(SheddingOrder[0]))
+
+/**********************class OverrunMonitor**********************/
+/* public function */
+OverrunMonitor::OverrunMonitor()
+    : level(0), load(0), underloadTicks(0), raiseTicks(0), degradedTicks(0)
+{
+}
+
+OverrunMonitor::~OverrunMonitor()
+{
+}
+
+bool OverrunMonitor::Admit(NetId netId, TableId tableId, uint_t lateness)
+{
+    Counter &counter = counters[GetKey(netId, tableId)];
+    ++counter.firedNumber;
+    if (lateness != 0)
+    {
+        ++counter.overrunNumber;
+        counter.totalLateness = counter.totalLateness + lateness;
+        counter.maxLateness = std::max(counter.maxLateness, (uint64_t)lateness);
+    }
+
+    int rank = GetRank(tableId);
+    if (rank < 0 || (uint_t)rank >= level)
+    {
+        return true;
+    }
+
+    /* stretch the interval, send once every 2^(level - rank) firings. */
+    uint64_t period = (uint64_t)1 << (level - rank);
+    if (counter.firedNumber % period == 0)
+    {
+        return true;
+    }
+
+    ++counter.shedNumber;
+    return false;
+}
+
+bool OverrunMonitor::AccountTick(uint_t busyMsec, uint_t tickMsec)
+{
+    uint_t tickLoad = busyMsec * 100 / std::max(tickMsec, (uint_t)1);
+    load = (load * 7 + tickLoad) / 8;
+    ++raiseTicks;
+    if (level != 0)
+    {
+        ++degradedTicks;
+    }
+
+    if (load > OverloadPercent)
+    {
+        underloadTicks = 0;
+        if (level < MaxDegradationLevel && raiseTicks >= RaiseTickNumber)
+        {
+            ++level;
+            raiseTicks = 0;
+            return true;
+        }
+        return false;
+    }
+
+    if (load < UnderloadPercent && level != 0)
+    {
+        if (++underloadTicks >= RecoverTickNumber)
+        {
+            --level;
+            underloadTicks = 0;
+            return true;
+        }
+        return false;
+    }
+
+    underloadTicks = 0;
+    return false;
+}
+
+const OverrunMonitor::Counter * OverrunMonitor::GetCounter(NetId netId, TableId tableId) const
+{
+    unordered_map<uint32_t, Counter>::const_iterator iter = counters.find(GetKey(netId, tableId));
+    if (iter == counters.end())
+    {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+uint64_t OverrunMonitor::GetDegradedTickNumber() const
+{
+    return degradedTicks;
+}
+
+uint_t OverrunMonitor::GetLevel() const
+{
+    return level;
+}
+
+uint_t OverrunMonitor::GetLoad() const
+{
+    return load;
+}
+
+void OverrunMonitor::Put(std::ostream& os) const
+{
+    uint64_t overrunNumber = 0, shedNumber = 0, maxLateness = 0;
+    unordered_map<uint32_t, Counter>::const_iterator iter;
+    for (iter = counters.begin(); iter != counters.end(); ++iter)
+    {
+        overrunNumber = overrunNumber + iter->second.overrunNumber;
+        shedNumber = shedNumber + iter->second.shedNumber;
+        maxLateness = std::max(maxLateness, iter->second.maxLateness);
+    }
+
+    os << "degradation level = " << level
+       << ", load = " << load << "%"
+       << ", degraded ticks = " << degradedTicks
+       << ", overrun = " << overrunNumber
+       << ", max lateness(ticks) = " << maxLateness
+       << ", shed = " << shedNumber;
+}
+
+/* private function */
+uint32_t OverrunMonitor::GetKey(NetId netId, TableId tableId)
+{
+    return ((uint32_t)netId << 8) | tableId;
+}
+
+int OverrunMonitor::GetRank(TableId tableId)
+{
+    for (size_t i = 0; i < MaxDegradationLevel; ++i)
+    {
+        if (SheddingOrder[i] == tableId)
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,88 @@
+#ifndef _OverrunMonitor_h_
+#define _OverrunMonitor_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+/* load (busy time / tick time, in percent) above OverloadPercent raises the degradation
+   level, load below UnderloadPercent for RecoverTickNumber ticks lowers it.
+ */
+#define OverloadPercent     90
+#define UnderloadPercent    50
+#define RecoverTickNumber   100
+/* min tick number between two raising of degradation level, so the load average can
+   show the effect of last raising.
+ */
+#define RaiseTickNumber     8
+
+/**********************class OverrunMonitor**********************/
+/* deadline overrun accounting of every {NetId, TableId}, and load shedding.
+   tables are shed in the order of SheddingOrder[], lowest priority first. at degradation
+   level n, the first n tables of SheddingOrder[] are stretched, the table of rank r
+   (0 based) is sent once every 2^(n - r) firings.  p/f, nit actual and sdt actual are
+   never shed.
+   Example:
+    OverrunMonitor monitor;
+    if (monitor.Admit(netId, tableId, lateness))
+    {
+        send table ...
+    }
+    ...
+    monitor.AccountTick(busyMsec, tickMsec);
+ */
+class OverrunMonitor
+{
+public:
+    struct Counter
+    {
+        Counter()
+            : firedNumber(0), overrunNumber(0), totalLateness(0), maxLateness(0), shedNumber(0)
+        {}
+
+        uint64_t firedNumber;   //number of timer firing.
+        uint64_t overrunNumber; //number of firing later than deadline.
+        uint64_t totalLateness; //in ticks.
+        uint64_t maxLateness;   //in ticks.
+        uint64_t shedNumber;    //number of firing which is skipped by load shedding.
+    };
+
+    OverrunMonitor();
+    ~OverrunMonitor();
+
+    /* account a timer firing, "lateness" is the ticks between deadline and firing.
+       return false if the table should be skipped this time.
+     */
+    bool Admit(NetId netId, TableId tableId, uint_t lateness);
+    /* account the time spent by one tick, the degradation level is adjusted.
+       return true if the level is changed.
+     */
+    bool AccountTick(uint_t busyMsec, uint_t tickMsec);
+
+    const Counter * GetCounter(NetId netId, TableId tableId) const;
+    uint64_t GetDegradedTickNumber() const;
+    uint_t   GetLevel() const;
+    uint_t   GetLoad() const;
+    void Put(std::ostream& os) const;
+
+private:
+    static uint32_t GetKey(NetId netId, TableId tableId);
+    static int GetRank(TableId tableId);
+
+private:
+    std::unordered_map<uint32_t, Counter> counters;
+    uint_t   level;
+    uint_t   load;              //moving average of busy time / tick time, in percent.
+    uint_t   underloadTicks;    //continuous ticks with load < UnderloadPercent.
+    uint_t   raiseTicks;        //ticks since last raising of level.
+    uint64_t degradedTicks;     //number of ticks with level > 0.
+};
+
+inline std::ostream& operator << (std::ostream& os, const OverrunMonitor& value)
+{
+    value.Put(os);
+    return os;
+}
+
+#endif
@@ -0,0 +1,560 @@
+#include "Include/Foundation/SystemInclude.h"
+#pragma warning(push)
+#pragma warning(disable:702)   //disable warning caused by ACE library.
+#pragma warning(disable:4251)  //disable warning caused by ACE library.
+#pragma warning(disable:4996)  //disable warning caused by ACE library.
+#include "ace/OS.h"
+#include "ace/Mem_Map.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/Crc32.h"
+#include "Include/Foundation/PacketHelper.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+
+/* Controller */
+#include "Snapshot.h"
+using namespace std;
+
+/* increase SnapshotVersion when the record format is changed. */
+#define SnapshotMagic   0x47534E50   //"GSNP"
+#define SnapshotVersion 1
+#define SnapshotHeaderSize 12       //magic + version + entry number
+
+enum: uchar_t
+{
+    CreateBatOperation = 1,
+    CreateEitOperation,
+    CreateNitOperation,
+    CreateSdtOperation,
+    AddDescriptorOperation,
+    AddEventOperation,
+    AddEventDescriptorOperation,
+    AddServiceOperation,
+    AddServiceDescriptorOperation,
+    AddTsOperation,
+    AddTsDescriptorOperation,
+    SealOperation
+};
+
+/**********************class RecordReader**********************/
+class RecordReader
+{
+public:
+    RecordReader(const uchar_t *buffer, size_t bufferSize)
+        : ptr(buffer), end(buffer + bufferSize)
+    {}
+
+    bool IsEnd() const
+    {
+        return ptr == end;
+    }
+
+    template <typename T>
+    bool Get(T &value)
+    {
+        if ((size_t)(end - ptr) < sizeof(T))
+            return false;
+
+        ptr = ptr + ReadBuffer((uchar_t*)ptr, value);
+        return true;
+    }
+
+    bool GetString(string &value)
+    {
+        uint32_t size;
+        if (!Get(size) || (size_t)(end - ptr) < size)
+            return false;
+
+        value.assign((const char*)ptr, size);
+        ptr = ptr + size;
+        return true;
+    }
+
+    /* value points to the bytes in the buffer, nothing is copied. */
+    bool GetBytes(const uchar_t *&value, uint32_t &size)
+    {
+        if (!Get(size) || (size_t)(end - ptr) < size)
+            return false;
+
+        value = ptr;
+        ptr = ptr + size;
+        return true;
+    }
+
+private:
+    const uchar_t *ptr;
+    const uchar_t *end;
+};
+
+/**********************class SiTableRecorder**********************/
+/* public function */
+SiTableRecorder::~SiTableRecorder()
+{
+    delete siTable;
+}
+
+void SiTableRecorder::AddDescriptor(std::string &data)
+{
+    PutOperation(AddDescriptorOperation);
+    PutString(data.data(), data.size());
+    siTable->AddDescriptor(data);
+}
+
+void SiTableRecorder::AddEvent(EventId eventId, const char *startTime, time_t duration,
+                               uint16_t runningStatus, uint16_t freeCaMode)
+{
+    PutOperation(AddEventOperation);
+    PutValue(eventId);
+    PutString(startTime, strlen(startTime));
+    PutValue((uint32_t)duration);
+    PutValue(runningStatus);
+    PutValue(freeCaMode);
+    siTable->AddEvent(eventId, startTime, duration, runningStatus, freeCaMode);
+}
+
+void SiTableRecorder::AddEventDescriptor(EventId eventId, std::string &data)
+{
+    PutOperation(AddEventDescriptorOperation);
+    PutValue(eventId);
+    PutString(data.data(), data.size());
+    siTable->AddEventDescriptor(eventId, data);
+}
+
+void SiTableRecorder::AddService(ServiceId serviceId, uchar_t eitScheduleFlag,
+                                 uchar_t eitPresentFollowingFlag, uint16_t runningStatus,
+                                 uint16_t freeCaMode)
+{
+    PutOperation(AddServiceOperation);
+    PutValue(serviceId);
+    PutValue(eitScheduleFlag);
+    PutValue(eitPresentFollowingFlag);
+    PutValue(runningStatus);
+    PutValue(freeCaMode);
+    siTable->AddService(serviceId, eitScheduleFlag, eitPresentFollowingFlag, runningStatus, freeCaMode);
+}
+
+void SiTableRecorder::AddServiceDescriptor(ServiceId serviceId, std::string &data)
+{
+    PutOperation(AddServiceDescriptorOperation);
+    PutValue(serviceId);
+    PutString(data.data(), data.size());
+    siTable->AddServiceDescriptor(serviceId, data);
+}
+
+void SiTableRecorder::AddTs(TsId tsId, OnId onId)
+{
+    PutOperation(AddTsOperation);
+    PutValue(tsId);
+    PutValue(onId);
+    siTable->AddTs(tsId, onId);
+}
+
+void SiTableRecorder::AddTsDescriptor(TsId tsId, std::string &data)
+{
+    PutOperation(AddTsDescriptorOperation);
+    PutValue(tsId);
+    PutString(data.data(), data.size());
+    siTable->AddTsDescriptor(tsId, data);
+}
+
+const std::vector<uchar_t>& SiTableRecorder::GetRecords() const
+{
+    return records;
+}
+
+SiTableInterface * SiTableRecorder::Release()
+{
+    SiTableInterface *ret = siTable;
+    siTable = nullptr;
+    return ret;
+}
+
+void SiTableRecorder::Seal()
+{
+    PutOperation(SealOperation);
+    siTable->Seal();
+}
+
+/* static function */
+SiTableRecorder * SiTableRecorder::CreateBatInstance(TableId tableId, BouquetId bouquetId,  Version versionNumber)
+{
+    SiTableRecorder *recorder = new SiTableRecorder(SiTableInterface::CreateBatInstance(tableId, bouquetId, versionNumber));
+    recorder->PutOperation(CreateBatOperation);
+    recorder->PutValue(tableId);
+    recorder->PutValue(bouquetId);
+    recorder->PutValue(versionNumber);
+    return recorder;
+}
+
+SiTableRecorder * SiTableRecorder::CreateEitInstance(TableId tableId, ServiceId serviceId, Version versionNumber,
+                                                     TsId transportStreamId, NetId originalNetworkId)
+{
+    SiTableRecorder *recorder = new SiTableRecorder(SiTableInterface::CreateEitInstance(tableId, serviceId, versionNumber,
+                                                                                        transportStreamId, originalNetworkId));
+    recorder->PutOperation(CreateEitOperation);
+    recorder->PutValue(tableId);
+    recorder->PutValue(serviceId);
+    recorder->PutValue(versionNumber);
+    recorder->PutValue(transportStreamId);
+    recorder->PutValue(originalNetworkId);
+    return recorder;
+}
+
+SiTableRecorder * SiTableRecorder::CreateNitInstance(TableId tableId, NetId networkId,  Version versionNumber)
+{
+    SiTableRecorder *recorder = new SiTableRecorder(SiTableInterface::CreateNitInstance(tableId, networkId, versionNumber));
+    recorder->PutOperation(CreateNitOperation);
+    recorder->PutValue(tableId);
+    recorder->PutValue(networkId);
+    recorder->PutValue(versionNumber);
+    return recorder;
+}
+
+SiTableRecorder * SiTableRecorder::CreateSdtInstance(TableId tableId, TsId transportStreamId,
+                                                     Version versionNumber, NetId originalNetworkId)
+{
+    SiTableRecorder *recorder = new SiTableRecorder(SiTableInterface::CreateSdtInstance(tableId, transportStreamId,
+                                                                                        versionNumber, originalNetworkId));
+    recorder->PutOperation(CreateSdtOperation);
+    recorder->PutValue(tableId);
+    recorder->PutValue(transportStreamId);
+    recorder->PutValue(versionNumber);
+    recorder->PutValue(originalNetworkId);
+    return recorder;
+}
+
+bool SiTableRecorder::Replay(const uchar_t *records, size_t size, std::list<SiTableInterface*> &siTables)
+{
+    RecordReader reader(records, size);
+    list<SiTableInterface*> replayed;
+    SiTableInterface *siTable = nullptr;
+    bool ok = true;
+
+    while (ok && !reader.IsEnd())
+    {
+        uchar_t operation;
+        TableId tableId;
+        Version versionNumber;
+        uint16_t id1, id2, id3;
+        uint16_t runningStatus, freeCaMode;
+        uchar_t  flag1, flag2;
+        uint32_t duration;
+        string   data;
+
+        /* a truncated record is corrupted too. */
+        if (!reader.Get(operation) || (operation > CreateSdtOperation && siTable == nullptr))
+        {
+            ok = false;
+            break;
+        }
+
+        switch (operation)
+        {
+        case CreateBatOperation:
+            ok = reader.Get(tableId) && reader.Get(id1) && reader.Get(versionNumber);
+            siTable = ok ? SiTableInterface::CreateBatInstance(tableId, id1, versionNumber) : nullptr;
+            break;
+
+        case CreateEitOperation:
+            ok = reader.Get(tableId) && reader.Get(id1) && reader.Get(versionNumber)
+                 && reader.Get(id2) && reader.Get(id3);
+            siTable = ok ? SiTableInterface::CreateEitInstance(tableId, id1, versionNumber, id2, id3) : nullptr;
+            break;
+
+        case CreateNitOperation:
+            ok = reader.Get(tableId) && reader.Get(id1) && reader.Get(versionNumber);
+            siTable = ok ? SiTableInterface::CreateNitInstance(tableId, id1, versionNumber) : nullptr;
+            break;
+
+        case CreateSdtOperation:
+            ok = reader.Get(tableId) && reader.Get(id1) && reader.Get(versionNumber) && reader.Get(id2);
+            siTable = ok ? SiTableInterface::CreateSdtInstance(tableId, id1, versionNumber, id2) : nullptr;
+            break;
+
+        case AddDescriptorOperation:
+            ok = reader.GetString(data);
+            if (ok)
+                siTable->AddDescriptor(data);
+            break;
+
+        case AddEventOperation:
+            ok = reader.Get(id1) && reader.GetString(data) && reader.Get(duration)
+                 && reader.Get(runningStatus) && reader.Get(freeCaMode);
+            if (ok)
+                siTable->AddEvent(id1, data.c_str(), duration, runningStatus, freeCaMode);
+            break;
+
+        case AddEventDescriptorOperation:
+            ok = reader.Get(id1) && reader.GetString(data);
+            if (ok)
+                siTable->AddEventDescriptor(id1, data);
+            break;
+
+        case AddServiceOperation:
+            ok = reader.Get(id1) && reader.Get(flag1) && reader.Get(flag2)
+                 && reader.Get(runningStatus) && reader.Get(freeCaMode);
+            if (ok)
+                siTable->AddService(id1, flag1, flag2, runningStatus, freeCaMode);
+            break;
+
+        case AddServiceDescriptorOperation:
+            ok = reader.Get(id1) && reader.GetString(data);
+            if (ok)
+                siTable->AddServiceDescriptor(id1, data);
+            break;
+
+        case AddTsOperation:
+            ok = reader.Get(id1) && reader.Get(id2);
+            if (ok)
+                siTable->AddTs(id1, id2);
+            break;
+
+        case AddTsDescriptorOperation:
+            ok = reader.Get(id1) && reader.GetString(data);
+            if (ok)
+                siTable->AddTsDescriptor(id1, data);
+            break;
+
+        case SealOperation:
+            siTable->Seal();
+            break;
+
+        default:
+            ok = false;
+            break;
+        }
+
+        if (ok && operation <= CreateSdtOperation)
+        {
+            replayed.push_back(siTable);
+        }
+    }
+
+    if (!ok)
+    {
+        for_each(replayed.begin(), replayed.end(), [](SiTableInterface *iter){ delete iter; });
+        return false;
+    }
+
+    siTables.splice(siTables.end(), replayed);
+    return true;
+}
+
+/* private function */
+SiTableRecorder::SiTableRecorder(SiTableInterface *siTable)
+    : siTable(siTable)
+{
+}
+
+void SiTableRecorder::PutOperation(uchar_t operation)
+{
+    records.push_back(operation);
+}
+
+void SiTableRecorder::PutString(const char *data, size_t size)
+{
+    PutValue((uint32_t)size);
+    records.insert(records.end(), data, data + size);
+}
+
+template <typename T>
+void SiTableRecorder::PutValue(T value)
+{
+    uchar_t buffer[sizeof(T)];
+    WriteBuffer(buffer, value);
+    records.insert(records.end(), buffer, buffer + sizeof(T));
+}
+
+/**********************class Snapshot**********************/
+/* public function */
+Snapshot::Snapshot()
+{
+}
+
+Snapshot::~Snapshot()
+{
+}
+
+void Snapshot::Add(uint64_t fileHash, const std::vector<uchar_t> &records)
+{
+    added[fileHash] = records;
+}
+
+bool Snapshot::Load(const char *path)
+{
+    memMap.close();
+    mapped.clear();
+    if ((ACE_OS::access(path, F_OK)) != 0)
+    {
+        return false;
+    }
+
+    if (memMap.map(path, static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_READ, ACE_MAP_PRIVATE) != 0)
+    {
+        errstrm << "Error when mapping " << path << endl;
+        return false;
+    }
+
+    const uchar_t *buffer = (const uchar_t *)memMap.addr();
+    size_t size = memMap.size();
+    if (size < SnapshotHeaderSize + sizeof(uint32_t))
+    {
+        errstrm << "Invalid snapshot " << path << endl;
+        memMap.close();
+        return false;
+    }
+
+    uint32_t crc;
+    ReadBuffer((uchar_t*)buffer + size - sizeof(uint32_t), crc);
+    if (crc != Crc32::CalculateCrc(buffer, size - sizeof(uint32_t)))
+    {
+        errstrm << "Crc error, snapshot " << path << endl;
+        memMap.close();
+        return false;
+    }
+
+    RecordReader reader(buffer, size - sizeof(uint32_t));
+    uint32_t magic, version, entryNumber;
+    reader.Get(magic);
+    reader.Get(version);
+    reader.Get(entryNumber);
+    if (magic != SnapshotMagic || version != SnapshotVersion)
+    {
+        errstrm << "Snapshot " << path << " was created by other version." << endl;
+        memMap.close();
+        return false;
+    }
+
+    std::map<uint64_t, std::pair<size_t, size_t>> loaded;
+    for (uint32_t i = 0; i < entryNumber; ++i)
+    {
+        uint64_t fileHash;
+        const uchar_t *records;
+        uint32_t recordsSize;
+        if (!reader.Get(fileHash) || !reader.GetBytes(records, recordsSize))
+        {
+            errstrm << "Invalid snapshot " << path << endl;
+            memMap.close();
+            return false;
+        }
+        loaded[fileHash] = make_pair((size_t)(records - buffer), (size_t)recordsSize);
+    }
+
+    mapped.swap(loaded);
+    return true;
+}
+
+bool Snapshot::Replay(uint64_t fileHash, std::list<SiTableInterface*> &siTables) const
+{
+    std::map<uint64_t, std::vector<uchar_t>>::const_iterator addedIter = added.find(fileHash);
+    if (addedIter != added.end())
+    {
+        return SiTableRecorder::Replay(addedIter->second.data(), addedIter->second.size(), siTables);
+    }
+
+    std::map<uint64_t, std::pair<size_t, size_t>>::const_iterator iter = mapped.find(fileHash);
+    if (iter == mapped.end())
+    {
+        return false;
+    }
+
+    const uchar_t *buffer = (const uchar_t *)memMap.addr();
+    return SiTableRecorder::Replay(buffer + iter->second.first, iter->second.second, siTables);
+}
+
+bool Snapshot::Save(const char *path, const std::set<uint64_t> &fileHashes)
+{
+    /* {records, size} of every kept entry, the mapped records are written before the
+       file is unmapped.
+     */
+    std::map<uint64_t, std::pair<const uchar_t*, size_t>> kept;
+    std::set<uint64_t>::const_iterator hashIter;
+    for (hashIter = fileHashes.begin(); hashIter != fileHashes.end(); ++hashIter)
+    {
+        std::map<uint64_t, std::vector<uchar_t>>::iterator addedIter = added.find(*hashIter);
+        std::map<uint64_t, std::pair<size_t, size_t>>::iterator mappedIter = mapped.find(*hashIter);
+        if (addedIter != added.end())
+        {
+            kept[*hashIter] = make_pair((const uchar_t*)addedIter->second.data(), addedIter->second.size());
+        }
+        else if (mappedIter != mapped.end())
+        {
+            const uchar_t *buffer = (const uchar_t *)memMap.addr();
+            kept[*hashIter] = make_pair(buffer + mappedIter->second.first, mappedIter->second.second);
+        }
+    }
+
+    /* the mapped file can't be overwritten, write a temporary file and rename it. */
+    string tmpPath = string(path) + string(".tmp");
+    ofstream file(tmpPath.c_str(), ios::out | ios::binary | ios::trunc);
+    uint32_t crc = 0xFFFFFFFF;
+    auto put = [&file, &crc](const uchar_t *data, size_t size)
+    {
+        crc = Crc32::UpdateCrc(crc, data, size);
+        file.write((const char*)data, size);
+    };
+
+    uchar_t buffer[SnapshotHeaderSize];
+    uchar_t *ptr = buffer;
+    ptr = ptr + Write32(ptr, SnapshotMagic);
+    ptr = ptr + Write32(ptr, SnapshotVersion);
+    ptr = ptr + Write32(ptr, (uint32_t)kept.size());
+    put(buffer, ptr - buffer);
+
+    std::map<uint64_t, std::pair<const uchar_t*, size_t>>::iterator iter;
+    for (iter = kept.begin(); iter != kept.end(); ++iter)
+    {
+        ptr = buffer;
+        ptr = ptr + Write64(ptr, iter->first);
+        ptr = ptr + Write32(ptr, (uint32_t)iter->second.second);
+        put(buffer, ptr - buffer);
+        put(iter->second.first, iter->second.second);
+    }
+    ptr = buffer;
+    ptr = ptr + Write32(ptr, crc);
+    file.write((const char*)buffer, ptr - buffer);
+    file.close();
+    if (!file)
+    {
+        errstrm << "Error when writing " << tmpPath << endl;
+        ACE_OS::unlink(tmpPath.c_str());
+        return false;
+    }
+
+    memMap.close();
+    mapped.clear();
+    bool renamed = (ACE_OS::rename(tmpPath.c_str(), path) == 0);
+    if (!renamed)
+    {
+        errstrm << "Error when renaming " << tmpPath << " to " << path << endl;
+    }
+
+    /* the saved records are replayed from the mapped file, records of the files which 
+       are gone are dropped.  if the new file isn't mapped, the records in memory are kept.
+     */
+    if (Load(path) && renamed)
+    {
+        added.clear();
+        return true;
+    }
+
+    std::map<uint64_t, std::vector<uchar_t>>::iterator addedIter;
+    for (addedIter = added.begin(); addedIter != added.end();)
+    {
+        if (fileHashes.find(addedIter->first) == fileHashes.end())
+        {
+            addedIter = added.erase(addedIter);
+        }
+        else
+        {
+            ++addedIter;
+        }
+    }
+    return false;
+}
+
+#pragma warning(pop)
@@ -0,0 +1,107 @@
+#ifndef _Snapshot_h_
+#define _Snapshot_h_
+
+#include "Include/Foundation/SystemInclude.h"
+#include "ace/Mem_Map.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+class SiTableInterface;
+
+/**********************class SiTableRecorder**********************/
+/* SiTable type for SiTableXmlWrapperInterface<>, it forwards every call to a real
+   SiTableInterface and records the call, the records can be replayed later to
+   build the same table without parsing the xml file again.
+   Example:
+    SiTableXmlWrapperInterface<SiTableRecorder> &wrapper = ...;
+    list<SiTableRecorder*> recorders = wrapper.Select(path);
+    for (auto iter: recorders)
+    {
+        records.insert(records.end(), iter->GetRecords().begin(), iter->GetRecords().end());
+        siTables.push_back(iter->Release());
+        delete iter;
+    }
+    ...
+    SiTableRecorder::Replay(records.data(), records.size(), siTables);
+ */
+class SiTableRecorder
+{
+public:
+    ~SiTableRecorder();
+
+    void AddDescriptor(std::string &data);
+    void AddEvent(EventId eventId, const char *startTime, time_t duration,
+                  uint16_t runningStatus, uint16_t freeCaMode);
+    void AddEventDescriptor(EventId eventId, std::string &data);
+    void AddService(ServiceId serviceId, uchar_t eitScheduleFlag,
+                    uchar_t eitPresentFollowingFlag, uint16_t runningStatus,
+                    uint16_t freeCaMode);
+    void AddServiceDescriptor(ServiceId serviceId, std::string &data);
+    void AddTs(TsId tsId, OnId onId);
+    void AddTsDescriptor(TsId tsId, std::string &data);
+
+    const std::vector<uchar_t>& GetRecords() const;
+    /* give up the ownership of the recorded table. */
+    SiTableInterface * Release();
+    void Seal();
+
+    /* static function */
+    static SiTableRecorder * CreateBatInstance(TableId tableId, BouquetId bouquetId,  Version versionNumber);
+    static SiTableRecorder * CreateEitInstance(TableId tableId, ServiceId serviceId, Version versionNumber,
+                                               TsId transportStreamId, NetId originalNetworkId);
+    static SiTableRecorder * CreateNitInstance(TableId tableId, NetId networkId,  Version versionNumber);
+    static SiTableRecorder * CreateSdtInstance(TableId tableId, TsId transportStreamId,
+                                               Version versionNumber, NetId originalNetworkId);
+    /* rebuild tables from records, return false if the records are corrupted. */
+    static bool Replay(const uchar_t *records, size_t size, std::list<SiTableInterface*> &siTables);
+
+private:
+    SiTableRecorder(SiTableInterface *siTable);
+    void PutOperation(uchar_t operation);
+    void PutString(const char *data, size_t size);
+    template <typename T>
+    void PutValue(T value);
+
+private:
+    SiTableInterface *siTable;
+    std::vector<uchar_t> records;
+};
+
+/**********************class Snapshot**********************/
+/* records of every xml file, keyed by XxHash of the file content, persisted in
+   a versioned binary file:
+        magic        4 bytes  "GSNP"
+        version      4 bytes
+        entry number 4 bytes
+        {
+            file hash    8 bytes
+            records size 4 bytes
+            records
+        } ...
+        crc32        4 bytes, crc of all bytes above.
+   the file keeps mapped, only {offset, size} of every entry is indexed, so the records
+   are paged in when they are replayed.  records of the files parsed after the file was
+   mapped are kept in memory until they are saved.
+ */
+class Snapshot
+{
+public:
+    Snapshot();
+    ~Snapshot();
+
+    void Add(uint64_t fileHash, const std::vector<uchar_t> &records);
+    /* map snapshot file, the existing entries are replaced by the file entries. */
+    bool Load(const char *path);
+    /* build tables of a file from snapshot, return false if not found. */
+    bool Replay(uint64_t fileHash, std::list<SiTableInterface*> &siTables) const;
+    /* drop entries which are not in fileHashes, write snapshot file, then map it again. */
+    bool Save(const char *path, const std::set<uint64_t> &fileHashes);
+
+private:
+    ACE_Mem_Map memMap;
+    std::map<uint64_t, std::pair<size_t, size_t>> mapped; //{offset, size} of records in memMap.
+    std::map<uint64_t, std::vector<uchar_t>> added;       //records which are not in memMap.
+};
+
+#endif
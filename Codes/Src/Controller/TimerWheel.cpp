@@ -0,0 +1,178 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+
+/* Controller */
+#include "TimerWheel.h"
+using namespace std;
+
+/**********************class TimerWheel**********************/
+/* public function */
+TimerWheel::TimerWheel()
+    : currentTick(0), advanceNumber(0)
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+}
+
+bool TimerWheel::Add(NetId netId, TableId tableId, uint_t delay, uint_t interval)
+{
+    pair<unordered_map<uint32_t, Timer>::iterator, bool> ret;
+    ret = timers.insert(make_pair(GetKey(netId, tableId), Timer(netId, tableId)));
+    if (!ret.second)
+    {
+        return false;
+    }
+
+    Timer *timer = &ret.first->second;
+    timer->expire = currentTick + delay;
+    timer->interval = std::max(interval, (uint_t)1);
+    timer->advanceNumber = 0;
+    Insert(timer);
+    return true;
+}
+
+void TimerWheel::Advance(uint64_t tick, std::list<TimerArg> &expired)
+{
+    ++advanceNumber;
+    for (; currentTick <= tick; ++currentTick)
+    {
+        /* level 0 wrapped, move the timers of upper level down. */
+        size_t index = (size_t)(currentTick & TimerWheelSlotMask);
+        for (uint_t level = 1; index == 0 && level < TimerWheelLevelNumber; ++level)
+        {
+            index = (size_t)((currentTick >> (TimerWheelLevelBits * level)) & TimerWheelSlotMask);
+            Cascade(level, index);
+        }
+
+        list<Timer*> due;
+        due.swap(slots[0][currentTick & TimerWheelSlotMask]);
+        for (list<Timer*>::iterator iter = due.begin(); iter != due.end(); ++iter)
+        {
+            Timer *timer = *iter;
+            if (timer->advanceNumber != advanceNumber)
+            {
+                timer->advanceNumber = advanceNumber;
+                timer->arg.lateness = (uint_t)(tick - currentTick);
+                expired.push_back(timer->arg);
+            }
+
+            timer->expire = currentTick + timer->interval;
+            Insert(timer);
+        }
+    }
+}
+
+bool TimerWheel::Delete(NetId netId, TableId tableId)
+{
+    unordered_map<uint32_t, Timer>::iterator iter = timers.find(GetKey(netId, tableId));
+    if (iter == timers.end())
+    {
+        return false;
+    }
+
+    Remove(&iter->second);
+    timers.erase(iter);
+    return true;
+}
+
+bool TimerWheel::Expedite(NetId netId, TableId tableId, uint64_t tick)
+{
+    unordered_map<uint32_t, Timer>::iterator iter = timers.find(GetKey(netId, tableId));
+    if (iter == timers.end())
+    {
+        return false;
+    }
+
+    Timer *timer = &iter->second;
+    if (timer->advanceNumber == advanceNumber || timer->expire > tick)
+    {
+        return false;
+    }
+
+    Remove(timer);
+    timer->advanceNumber = advanceNumber;
+    timer->expire = timer->expire + timer->interval;
+    Insert(timer);
+    return true;
+}
+
+bool TimerWheel::Find(NetId netId, TableId tableId) const
+{
+    return timers.find(GetKey(netId, tableId)) != timers.end();
+}
+
+uint64_t TimerWheel::GetCurrentTick() const
+{
+    return currentTick;
+}
+
+size_t TimerWheel::GetSize() const
+{
+    return timers.size();
+}
+
+bool TimerWheel::SetInterval(NetId netId, TableId tableId, uint_t interval)
+{
+    unordered_map<uint32_t, Timer>::iterator iter = timers.find(GetKey(netId, tableId));
+    if (iter == timers.end())
+    {
+        return false;
+    }
+
+    iter->second.interval = std::max(interval, (uint_t)1);
+    return true;
+}
+
+/* private function */
+uint32_t TimerWheel::GetKey(NetId netId, TableId tableId)
+{
+    return ((uint32_t)netId << 8) | tableId;
+}
+
+void TimerWheel::Cascade(uint_t level, size_t index)
+{
+    list<Timer*> cascaded;
+    cascaded.swap(slots[level][index]);
+    for (list<Timer*>::iterator iter = cascaded.begin(); iter != cascaded.end(); ++iter)
+    {
+        Insert(*iter);
+    }
+}
+
+void TimerWheel::Insert(Timer *timer)
+{
+    if (timer->expire < currentTick)
+    {
+        timer->expire = currentTick;
+    }
+
+    uint64_t delta = timer->expire - currentTick;
+    uint_t level;
+    for (level = 0; level < TimerWheelLevelNumber - 1; ++level)
+    {
+        if (delta < ((uint64_t)1 << (TimerWheelLevelBits * (level + 1))))
+        {
+            break;
+        }
+    }
+
+    uint64_t maxDelta = ((uint64_t)1 << (TimerWheelLevelBits * TimerWheelLevelNumber)) - 1;
+    if (delta > maxDelta)
+    {
+        timer->expire = currentTick + maxDelta;
+    }
+
+    size_t index = (size_t)((timer->expire >> (TimerWheelLevelBits * level)) & TimerWheelSlotMask);
+    timer->slot = &slots[level][index];
+    timer->position = timer->slot->insert(timer->slot->end(), timer);
+}
+
+void TimerWheel::Remove(Timer *timer)
+{
+    timer->slot->erase(timer->position);
+}
@@ -0,0 +1,90 @@
+#ifndef _TimerWheel_h_
+#define _TimerWheel_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+typedef long TimerId;
+struct TimerArg
+{
+    TimerArg(NetId netId, TableId tableId, uint_t lateness)
+        : netId(netId), tableId(tableId), lateness(lateness)
+    {}
+
+    NetId   netId;
+    TableId tableId;
+    uint_t  lateness;   //ticks between the deadline and the firing.
+};
+
+/* 4 levels, 64 slots per level, with 10 milliseconds tick the wheel covers
+   10ms * 64^4 = 46 hours.
+ */
+#define TimerWheelLevelBits   6
+#define TimerWheelSlotNumber  (1 << TimerWheelLevelBits)
+#define TimerWheelSlotMask    (TimerWheelSlotNumber - 1)
+#define TimerWheelLevelNumber 4
+
+/**********************class TimerWheel**********************/
+/* Hierarchical timer wheel of periodic {NetId, TableId} timers, it is driven by one
+   reactor timer, Add(), Delete() and firing a timer are O(1).
+   Example:
+    TimerWheel timerWheel;
+    timerWheel.Add(1, NitActualTableId, 0, 200);  // fire at tick 0, 200, 400 ...
+    timerWheel.Add(1, SdtActualTableId, 50, 200); // fire at tick 50, 250, 450 ...
+    ...
+    list<TimerArg> expired;
+    timerWheel.Advance(currentTick, expired);
+ */
+class TimerWheel
+{
+public:
+    TimerWheel();
+    ~TimerWheel();
+
+    /* delay and interval are in ticks, return false if the timer exists already. */
+    bool Add(NetId netId, TableId tableId, uint_t delay, uint_t interval);
+    /* move the wheel to "tick", timers expired on the way are appended to "expired"
+       (once per timer even if it expired several times), and are re-armed.
+     */
+    void Advance(uint64_t tick, std::list<TimerArg> &expired);
+    bool Delete(NetId netId, TableId tableId);
+    /* fire the timer ahead of time if it expires before or at "tick", and it was not 
+       fired by last Advance(). the timer is re-armed on its original phase.
+     */
+    bool Expedite(NetId netId, TableId tableId, uint64_t tick);
+    bool Find(NetId netId, TableId tableId) const;
+    uint64_t GetCurrentTick() const;
+    size_t GetSize() const;
+    /* change the interval of a timer, it takes effect from next firing. */
+    bool SetInterval(NetId netId, TableId tableId, uint_t interval);
+
+private:
+    struct Timer
+    {
+        Timer(NetId netId, TableId tableId)
+            : arg(netId, tableId, 0)
+        {}
+
+        TimerArg arg;
+        uint64_t expire;
+        uint_t   interval;
+        uint64_t advanceNumber;     //last Advance() which fired the timer.
+        std::list<Timer*> *slot;
+        std::list<Timer*>::iterator position;
+    };
+
+    static uint32_t GetKey(NetId netId, TableId tableId);
+    void Cascade(uint_t level, size_t index);
+    void Insert(Timer *timer);
+    void Remove(Timer *timer);
+
+private:
+    uint64_t currentTick;       //next tick to be processed.
+    uint64_t advanceNumber;
+    std::list<Timer*> slots[TimerWheelLevelNumber][TimerWheelSlotNumber];
+    std::unordered_map<uint32_t, Timer> timers;
+};
+
+#endif
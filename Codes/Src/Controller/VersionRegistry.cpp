@@ -0,0 +1,167 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/Crc32.h"
+#include "Include/Foundation/PacketHelper.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+
+/* Controller */
+#include "VersionRegistry.h"
+using namespace std;
+
+/* increase VersionRegistryVersion when the file format is changed. */
+#define VersionRegistryMagic      0x47564552   //"GVER"
+#define VersionRegistryVersion    1
+#define VersionRegistryHeaderSize 12           //magic + version + entry number
+#define VersionRegistryEntrySize  17           //sub_table + fingerprint + version
+#define MaxVersionNumber          32
+
+/**********************class VersionRegistry**********************/
+/* public function */
+VersionRegistry::VersionRegistry()
+    : dirty(false)
+{
+}
+
+VersionRegistry::~VersionRegistry()
+{
+}
+
+Version VersionRegistry::Assign(NetId netId, const SiTableInterface &siTable)
+{
+    uint64_t key = GetKey(netId, siTable.GetTableId(), siTable.GetKey());
+    uint64_t fingerprint = siTable.GetContentFingerprint();
+    unordered_map<uint64_t, Entry>::iterator iter = entries.find(key);
+    if (iter == entries.end())
+    {
+        Entry entry;
+        entry.fingerprint = fingerprint;
+        entry.versionNumber = siTable.GetVersion();
+        entries.insert(make_pair(key, entry));
+        dirty = true;
+        return entry.versionNumber;
+    }
+
+    if (iter->second.fingerprint != fingerprint)
+    {
+        iter->second.fingerprint = fingerprint;
+        iter->second.versionNumber = (Version)((iter->second.versionNumber + 1) % MaxVersionNumber);
+        dirty = true;
+    }
+    return iter->second.versionNumber;
+}
+
+bool VersionRegistry::IsDirty() const
+{
+    return dirty;
+}
+
+bool VersionRegistry::Load(const char *path)
+{
+    ifstream file(path, ios::in | ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    vector<uchar_t> buffer((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+
+    size_t size = buffer.size();
+    if (size < VersionRegistryHeaderSize + sizeof(uint32_t))
+    {
+        errstrm << "Invalid version registry " << path << endl;
+        return false;
+    }
+
+    uint32_t crc;
+    ReadBuffer(buffer.data() + size - sizeof(uint32_t), crc);
+    if (crc != Crc32::CalculateCrc(buffer.data(), size - sizeof(uint32_t)))
+    {
+        errstrm << "Crc error, version registry " << path << endl;
+        return false;
+    }
+
+    uchar_t *ptr = buffer.data();
+    uint32_t magic, version, entryNumber;
+    ptr = ptr + Read32(ptr, magic);
+    ptr = ptr + Read32(ptr, version);
+    ptr = ptr + Read32(ptr, entryNumber);
+    if (magic != VersionRegistryMagic || version != VersionRegistryVersion
+        || size != VersionRegistryHeaderSize + (size_t)entryNumber * VersionRegistryEntrySize + sizeof(uint32_t))
+    {
+        errstrm << "Version registry " << path << " was created by other version." << endl;
+        return false;
+    }
+
+    unordered_map<uint64_t, Entry> loaded;
+    for (uint32_t i = 0; i < entryNumber; ++i)
+    {
+        uint64_t key;
+        Entry entry;
+        ptr = ptr + Read64(ptr, key);
+        ptr = ptr + Read64(ptr, entry.fingerprint);
+        ptr = ptr + Read8(ptr, entry.versionNumber);
+        loaded[key] = entry;
+    }
+
+    entries.swap(loaded);
+    dirty = false;
+    return true;
+}
+
+void VersionRegistry::Remove(NetId netId, TableId tableId, SiTableKey tableKey)
+{
+    if (entries.erase(GetKey(netId, tableId, tableKey)) != 0)
+    {
+        dirty = true;
+    }
+}
+
+bool VersionRegistry::Save(const char *path)
+{
+    size_t size = VersionRegistryHeaderSize + entries.size() * VersionRegistryEntrySize + sizeof(uint32_t);
+    vector<uchar_t> buffer(size);
+    uchar_t *ptr = buffer.data();
+    ptr = ptr + Write32(ptr, VersionRegistryMagic);
+    ptr = ptr + Write32(ptr, VersionRegistryVersion);
+    ptr = ptr + Write32(ptr, (uint32_t)entries.size());
+    unordered_map<uint64_t, Entry>::const_iterator iter;
+    for (iter = entries.begin(); iter != entries.end(); ++iter)
+    {
+        ptr = ptr + Write64(ptr, iter->first);
+        ptr = ptr + Write64(ptr, iter->second.fingerprint);
+        ptr = ptr + Write8(ptr, iter->second.versionNumber);
+    }
+    ptr = ptr + Write32(ptr, Crc32::CalculateCrc(buffer.data(), ptr - buffer.data()));
+    assert(ptr == buffer.data() + size);
+
+    ofstream file(path, ios::out | ios::binary | ios::trunc);
+    if (!file || !file.write((const char*)buffer.data(), size))
+    {
+        errstrm << "Error when writing " << path << endl;
+        return false;
+    }
+    dirty = false;
+    return true;
+}
+
+void VersionRegistry::Update(NetId netId, const SiTableInterface &siTable)
+{
+    Entry &entry = entries[GetKey(netId, siTable.GetTableId(), siTable.GetKey())];
+    uint64_t fingerprint = siTable.GetContentFingerprint();
+    if (entry.fingerprint != fingerprint || entry.versionNumber != siTable.GetVersion())
+    {
+        entry.fingerprint = fingerprint;
+        entry.versionNumber = siTable.GetVersion();
+        dirty = true;
+    }
+}
+
+/* private function */
+uint64_t VersionRegistry::GetKey(NetId netId, TableId tableId, SiTableKey tableKey)
+{
+    return ((uint64_t)netId << 40) | ((uint64_t)tableId << 32) | tableKey;
+}
@@ -0,0 +1,70 @@
+#ifndef _VersionRegistry_h_
+#define _VersionRegistry_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+class SiTableInterface;
+
+/**********************class VersionRegistry**********************/
+/* version_number of every sub_table {NetId, TableId, SiTableKey}, derived from the content
+   fingerprint of the table instead of the xml file.  the version is increased (modulo 32)
+   only when the content is changed, a sub_table seen for the first time keeps the version
+   of the xml file.  the history is persisted in a versioned binary file:
+        magic        4 bytes  "GVER"
+        version      4 bytes
+        entry number 4 bytes
+        {
+            sub_table    8 bytes  NetId << 40 | TableId << 32 | SiTableKey
+            fingerprint  8 bytes
+            version      1 byte
+        } ...
+        crc32        4 bytes, crc of all bytes above.
+   Example:
+    VersionRegistry registry;
+    registry.Load(path);
+    siTable->SetVersion(registry.Assign(netId, *siTable));
+    siTable->Inherit(*liveTable);
+    registry.Update(netId, *siTable);
+    ...
+    registry.Remove(netId, tableId, tableKey);
+    ...
+    registry.Save(path);
+ */
+class VersionRegistry
+{
+public:
+    VersionRegistry();
+    ~VersionRegistry();
+
+    /* return the version_number of the sub_table of siTable. */
+    Version Assign(NetId netId, const SiTableInterface &siTable);
+    bool IsDirty() const;
+    bool Load(const char *path);
+    /* forget the sub_table when it is not on air any more, so the file doesn't grow with 
+       every service or transport stream which has come and gone.
+     */
+    void Remove(NetId netId, TableId tableId, SiTableKey tableKey);
+    bool Save(const char *path);
+    /* record the version_number which siTable is sent with, Inherit() may keep the version
+       of the live table, or increase it, after Assign().
+     */
+    void Update(NetId netId, const SiTableInterface &siTable);
+
+private:
+    struct Entry
+    {
+        uint64_t fingerprint;
+        Version  versionNumber;
+    };
+
+    static uint64_t GetKey(NetId netId, TableId tableId, SiTableKey tableKey);
+
+private:
+    std::unordered_map<uint64_t, Entry> entries;
+    bool dirty;     //entries are changed since last Load() or Save().
+};
+
+#endif
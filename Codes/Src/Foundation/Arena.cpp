@@ -0,0 +1,50 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Arena.h"
+using namespace std;
+
+#define ArenaAlignment (sizeof(void *) * 2)
+
+/**********************class Arena**********************/
+Arena::Arena()
+    : cur(nullptr), end(nullptr), nextBlockSize(MinBlockSize), capacity(0)
+{
+}
+
+Arena::~Arena()
+{
+    for (auto iter: blocks)
+    {
+        delete[] iter;
+    }
+}
+
+void *Arena::Allocate(size_t size)
+{
+    size = (size + ArenaAlignment - 1) & ~(ArenaAlignment - 1);
+    if (cur == nullptr || size > (size_t)(end - cur))
+    {
+        /* block size grows from MinBlockSize to MaxBlockSize, so that small table 
+           (for example a sdt with 1 service) doesn't waste too much memory.
+         */
+        size_t blockSize = max(size, nextBlockSize);
+        nextBlockSize = min(nextBlockSize * 2, (size_t)MaxBlockSize);
+
+        uchar_t *block = new uchar_t[blockSize];
+        blocks.push_back(block);
+        capacity = capacity + blockSize;
+        cur = block;
+        end = block + blockSize;
+    }
+
+    void *ptr = cur;
+    cur = cur + size;
+    return ptr;
+}
+
+size_t Arena::GetCapacity() const
+{
+    return capacity;
+}
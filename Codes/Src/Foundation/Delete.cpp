@@ -1,4 +1,4 @@
-#include "Include/Foundation/SystemInclude.h"
-
-#include "Include/Foundation/Deleter.h"
+#include "Include/Foundation/SystemInclude.h"
+
+#include "Include/Foundation/Deleter.h"
 using namespace std;
\ No newline at end of file
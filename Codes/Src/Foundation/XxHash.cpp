@@ -0,0 +1,109 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/XxHash.h"
+using namespace std;
+
+static const uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t Prime3 = 0x165667B19E3779F9ULL;
+static const uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t RotateLeft(uint64_t value, uint_t bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/* xxHash is defined on little endian words. */
+static inline uint64_t Read64(const uchar_t *ptr)
+{
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i)
+    {
+        value = (value << 8) | ptr[i];
+    }
+    return value;
+}
+
+static inline uint32_t Read32(const uchar_t *ptr)
+{
+    return (uint32_t)ptr[0] | ((uint32_t)ptr[1] << 8) | ((uint32_t)ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+}
+
+static inline uint64_t Round(uint64_t acc, uint64_t input)
+{
+    acc = acc + input * Prime2;
+    acc = RotateLeft(acc, 31);
+    return acc * Prime1;
+}
+
+static inline uint64_t MergeRound(uint64_t acc, uint64_t value)
+{
+    acc = acc ^ Round(0, value);
+    return acc * Prime1 + Prime4;
+}
+
+/**********************class XxHash**********************/
+uint64_t XxHash::CalculateHash(const uchar_t *buffer, size_t bufferSize, uint64_t seed)
+{
+    const uchar_t *ptr = buffer;
+    const uchar_t *end = buffer + bufferSize;
+    uint64_t hash;
+
+    if (bufferSize >= 32)
+    {
+        uint64_t v1 = seed + Prime1 + Prime2;
+        uint64_t v2 = seed + Prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - Prime1;
+
+        for (; ptr + 32 <= end; ptr = ptr + 32)
+        {
+            v1 = Round(v1, Read64(ptr));
+            v2 = Round(v2, Read64(ptr + 8));
+            v3 = Round(v3, Read64(ptr + 16));
+            v4 = Round(v4, Read64(ptr + 24));
+        }
+
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = MergeRound(hash, v1);
+        hash = MergeRound(hash, v2);
+        hash = MergeRound(hash, v3);
+        hash = MergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + Prime5;
+    }
+
+    hash = hash + (uint64_t)bufferSize;
+
+    for (; ptr + 8 <= end; ptr = ptr + 8)
+    {
+        hash = hash ^ Round(0, Read64(ptr));
+        hash = RotateLeft(hash, 27) * Prime1 + Prime4;
+    }
+
+    if (ptr + 4 <= end)
+    {
+        hash = hash ^ ((uint64_t)Read32(ptr) * Prime1);
+        hash = RotateLeft(hash, 23) * Prime2 + Prime3;
+        ptr = ptr + 4;
+    }
+
+    for (; ptr < end; ++ptr)
+    {
+        hash = hash ^ (*ptr * Prime5);
+        hash = RotateLeft(hash, 11) * Prime1;
+    }
+
+    /* avalanche */
+    hash = hash ^ (hash >> 33);
+    hash = hash * Prime2;
+    hash = hash ^ (hash >> 29);
+    hash = hash * Prime3;
+    hash = hash ^ (hash >> 32);
+
+    return hash;
+}
@@ -1,412 +1,1369 @@
-#include "Include/Foundation/SystemInclude.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/Deleter.h"
-#include "Include/Foundation/Debug.h"
-#include "Include/Foundation/PacketHelper.h"
-#include "Include/Foundation/Converter.h"
-#include "Include/Foundation/Crc32.h"
-#include "Include/Foundation/Time.h"
-
-/* TsPacketSiTable */
-#include "Include/TsPacketSiTable/SiTableInterface.h"
-#include "Eit.h"
-using namespace std;
-
-SiTableInterface * SiTableInterface::CreateEitInstance(TableId tableId, ServiceId serviceId, Version versionNumber,
-                                                       TsId transportStreamId, NetId originalNetworkId)
-{
-    return new EitTable(tableId, serviceId, versionNumber, transportStreamId, originalNetworkId);
-}
-
-/**********************public function**********************/
-uint32_t ConvertDateToMjd(uint32_t year, uint32_t month, uint32_t day)
-{
-    uint32_t l = (month == 1 || month == 2) ? 1 : 0;
-    return (14956 + day + (uint32_t)((year - l) * 365.25) + (uint32_t)((month + 1 + l * 12) * 30.6001));
-}
-
-void ConvertMjdToDate(uint32_t mjd, uint32_t &year, uint32_t &month, uint32_t &day)
-{
-     year  = (uint32_t)((mjd - 15078.2) / 365.25);
-     month = (uint32_t)((mjd - 14956.1 - uint32_t(year * 365.25)) / 30.6001);
-     day   = mjd - 14956 - uint32_t(year * 365.25) - uint32_t(month * 30.6001);
-     uint_t k = (month == 14 || month == 15) ? 1 : 0;
-     year = year + k;
-     month = month - 1 - k * 12;
-}
-
-/**********************class EitEvent**********************/
-EitEvent::EitEvent(EventId eventId, const char *startTime, 
-                   time_t duration, uint16_t runningStatus, uint16_t freeCaMode)
-    : eventId(eventId), startTime(startTime), 
-      duration(duration), runningStatus(runningStatus), freeCaMode(freeCaMode)
-{
-}
-
-EitEvent::~EitEvent()
-{
-}
-
-void EitEvent::AddDescriptor(Descriptor *descriptor)
-{
-    descriptors.AddDescriptor(descriptor);
-}
-
-size_t EitEvent::GetCodesSize() const
-{
-    size_t size = descriptors.GetCodesSize() + sizeof(event_information_section_detail);
-    assert(size <= MaxEitEventContentSize);
-    return size;
-}
-
-time_t EitEvent::GetDuration() const
-{
-    return duration;
-}
-
-EventId EitEvent::GetEventId() const
-{
-    return eventId;
-}
-
-const std::string &EitEvent::GetStartTime() const
-{
-    return startTime;
-}
-
-size_t EitEvent::MakeCodes(uchar_t *buffer, size_t bufferSize) const
-{
-    uchar_t *ptr = buffer;
-    size_t size = GetCodesSize();
-    assert(size <= bufferSize);
-    
-    ptr = ptr + Write16(ptr, eventId);
-
-    tm localTime, gmtTime;  
-    ConvertStrToTm(this->startTime.c_str(), localTime);
-    ConvertUtcToGmt(localTime, gmtTime);
-
-    uint32_t year, month, day, hour, minute, second;
-    year = gmtTime.tm_year;
-    month = gmtTime.tm_mon + 1;
-    day = gmtTime.tm_mday;
-    hour = gmtTime.tm_hour;
-    minute = gmtTime.tm_min;
-    second = gmtTime.tm_sec;
-
-    uint64_t startDate = ConvertDateToMjd(year, month, day);
-    uint64_t startTime = ((hour / 10) << 20) | ((hour % 10) << 16) 
-                | ((minute / 10) << 12) | ((minute % 10) << 8) 
-                | ((second / 10) << 4) | (second % 10);
-
-    chrono::seconds total(this->duration);
-    chrono::hours hours = chrono::duration_cast<chrono::hours>(total);
-    chrono::minutes minutes = chrono::duration_cast<chrono::minutes>(total - hours);
-    chrono::seconds seconds = chrono::duration_cast<chrono::seconds>(total - hours - minutes);
-
-    uint64_t duration = ((hours.count() / 10) << 20) | ((hours.count() % 10) << 16) 
-        | ((minutes.count() / 10) << 12) | ((minutes.count() % 10) << 8) 
-        | ((seconds.count() / 10) << 4) | (seconds.count() % 10);
-    ptr = ptr + Write64(ptr, (((startDate << 24) | (startTime)) << 24) | (duration & 0xFFFFFF));
-
-    WriteHelper<uint16_t> desHelper(ptr, ptr + 2);
-    //fill "reserved_future_use + network_descriptors_length" to 0 temporarily.
-    ptr = ptr + Write16(ptr, 0); 
-    ptr = ptr + descriptors.MakeCodes(ptr, bufferSize - (ptr - buffer));
-    desHelper.Write((runningStatus << 13) | (freeCaMode << 12), ptr); 
-    
-    assert(ptr - buffer == size);
-    return (ptr - buffer);
-}
-
-/**********************class EitEvents**********************/
-EitEvents::EitEvents()
-{
-    AllocProxy();
-}
-
-EitEvents::~EitEvents()
-{
-    for_each(eitEvents.begin(), eitEvents.end(), ScalarDeleter());
-    eitEvents.clear();
-    FreeProxy();
-}
-
-void EitEvents::AddEvent(EitEvent *eitEvent)
-{
-    eitEvents.push_back(eitEvent);
-}
-
-void EitEvents::AddEventDescriptor(uint16_t eventId, Descriptor *descriptor)
-{
-    list<EitEvent *>::iterator iter;
-    iter = find_if(eitEvents.begin(), eitEvents.end(), CompareEitEventId(eventId));
-    (*iter)->AddDescriptor(descriptor);
-}
-
-/* Input and Outpu  decision table.
-TableId     offset                                   return value
--------     ---------------------------------        -------------------------
-0x4e, 0x4f  0                                        size of "0 ~ (MaxEventNumberIn1EitPfTable - 1)"
-0x4e, 0x4f  0 + (MaxEventNumberIn1EitPfTable - 1)    size of "(MaxEventNumberIn1EitPfTable-1) ~ (MaxEventNumberIn1EitPfTable*2-1)"
-0x4e, 0x4f  0 + (MaxEventNumberIn1EitPfTable - 1)    0
-...
-...
- */
-size_t EitEvents::GetCodesSize(size_t maxSize, size_t offset, 
-                               uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const
-{
-    size_t size = 0;
-    uint_t eventNumber = 0;
-    
-    list<EitEvent *>::const_iterator iter; 
-    for (iter = Seek(offset, maxEventNumberInAllSection); iter != eitEvents.end(); ++iter)
-    {
-        if (size + (*iter)->GetCodesSize() > maxSize)
-        {
-            //at lest 1 EitEvent is counted.
-            assert(size != 0);
-            break;
-        }
-        size = size + (*iter)->GetCodesSize();  
-        if (++eventNumber == maxEventNumberIn1Section)
-        {
-            //we have packed MaxEventNumberIn1EitPfTable event in current section or previous section.
-            break;
-        }
-    }
-
-    return size; 
-}
-
-size_t EitEvents::MakeCodes(uchar_t *buffer, size_t bufferSize, size_t offset,
-                            uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const
-{
-    uchar_t *ptr = buffer;  
-    uint_t eventNumber = 0;
-
-    list<EitEvent *>::const_iterator iter;
-    for (iter = Seek(offset, maxEventNumberInAllSection); iter != eitEvents.end(); ++iter)
-    {
-        if (ptr + (*iter)->GetCodesSize() > buffer + bufferSize)
-        {
-            //at lest 1 EitEvent is counted.
-            assert(ptr != buffer);
-            break;
-        }
-        ptr = ptr + (*iter)->MakeCodes(ptr, buffer + bufferSize - ptr);    
-        if (++eventNumber == maxEventNumberIn1Section)
-        {
-            //we have packed MaxEventNumberIn1EitPfTable event in current section or previous section.
-            break;
-        }
-    }
-
-    return (ptr - buffer);
-}
-   
-bool EitEvents::RemoveOutOfDateEvent()
-{
-    time_t curTime = time(nullptr); 
-    list<EitEvent *>::iterator iter, start, end;
-
-    start = eitEvents.begin();
-    if (start == eitEvents.end())
-    {
-        return true;
-    }
-    time_t eventTime = ConvertStrToTime((*start)->GetStartTime().c_str()) + (*start)->GetDuration();
-    if (eventTime > curTime)
-    {
-        return true;
-    }
-
-    for (end = eitEvents.begin(); end != eitEvents.end(); ++end)
-    {
-        eventTime = ConvertStrToTime((*end)->GetStartTime().c_str()) + (*end)->GetDuration();
-        if (eventTime > curTime)
-        {
-            break;
-        }
-    }
-
-    for (iter = start; iter != end; ++iter)
-    {
-        delete *iter;
-    }
-
-    eitEvents.erase(start, end);
-    return false;
-}
-
-/* private function */
-list<EitEvent *>::const_iterator EitEvents::Seek(size_t offset, uint_t maxEventNumberInAllSection) const
-{
-    size_t curOffset = 0;
-    uint_t eventNumber = 0;
-
-    list<EitEvent *>::const_iterator iter;
-    for (iter = eitEvents.cbegin(); iter != eitEvents.cend(); ++iter)
-    {   
-        if (eventNumber++ == maxEventNumberInAllSection)
-        {
-            return eitEvents.cend();
-        }
-
-        if (curOffset >= offset)
-            break;
-
-        curOffset = curOffset + (*iter)->GetCodesSize();
-    }
-    assert(curOffset == offset);
-
-    return iter;
-}
-
-/**********************class EitTable**********************/
-EitTable::EitTable(TableId tableId, ServiceId serviceId, Version versionNumber, 
-                   TsId transportStreamId, NetId originalNetworkId)
-    : tableId(tableId), serviceId(serviceId), versionNumber(versionNumber),
-      transportStreamId(transportStreamId), originalNetworkId(originalNetworkId)
-{
-}
-
-EitTable::~EitTable()
-{    
-}
-
-void EitTable::AddEvent(EventId eventId, const char *startTime, 
-                time_t duration, uint16_t  runningStatus, uint16_t freeCaMode)
-{
-    EitEvent *eitEvent = new EitEvent(eventId, startTime, duration, runningStatus, freeCaMode);
-    eitEvents.AddEvent(eitEvent);
-    ClearCatch();
-}
-
-void EitTable::AddEventDescriptor(EventId eventId, std::string &data)
-{
-    Descriptor* descriptor = CreateDescriptor(data);
-    if (descriptor == nullptr)
-    {
-        errstrm << "we do not support descriptor whose tag = " 
-            << hex << data[0] << data[1] << endl;
-        return;
-    }
-
-    eitEvents.AddEventDescriptor(eventId, descriptor);
-    ClearCatch();
-}
-
-
-SiTableKey EitTable::GetKey() const
-{
-    SiTableKey key = (transportStreamId << 16) | serviceId;
-    return key;
-}
-
-TableId EitTable::GetTableId() const
-{
-    return tableId;
-}
-
-void EitTable::RefreshCatch()
-{
-    if (eitEvents.RemoveOutOfDateEvent())
-    {
-        return;
-    }
-    ClearCatch();
-}
-
-/* protected function */
-bool EitTable::CheckTableId(TableId tableId) const
-{
-    if (this->tableId == EitActualSchTableId)
-    {
-        if (tableId != EitActualPfTableId && tableId != EitActualSchTableId)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        if (tableId != EitOtherPfTableId && tableId != EitOtherSchTableId)
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-bool EitTable::CheckTsId(TsId tsid) const
-{
-    return (tsid == this->transportStreamId);
-}
-
-size_t EitTable::GetFixedSize() const
-{
-    return EitFixedFieldSize;
-}
-
-size_t EitTable::GetVarSize() const
-{
-    return MaxEitEventContentSize;
-}
-
-const EitTable::Var1& EitTable::GetVar1() const
-{
-    return varHelper;
-}
-
-EitTable::Var2 EitTable::GetVar2(TableId tableId) const
-{
-    if (tableId == EitActualPfTableId || tableId == EitOtherPfTableId)
-    {
-        return Var2(eitEvents, MaxEventNumberIn1EitPfSection, MaxEventNumberInAllEitPfSection);
-    }
-
-    return Var2(eitEvents, UINT_MAX, UINT_MAX);
-}
-
-size_t EitTable::MakeCodes1(TableId tableId, uchar_t *buffer, size_t bufferSize, size_t var1Size,
-                            SectionNumber secNumber, SectionNumber lastSecNumber) const
-{
-    uchar_t *ptr = buffer;
-    
-    //section_syntax_indicator:1 + reserved_future_use1:1 + reserved1:2 + section_length:12
-    TableSize pseudoSize = 0;
-    ptr = ptr + WriteBuffer(ptr, tableId);
-    ptr = ptr + WriteBuffer(ptr, pseudoSize); 
-    ptr = ptr + WriteBuffer(ptr, serviceId); //service_id
-
-    uchar_t currentNextIndicator = 1;
-    ptr = ptr + Write8(ptr, (Reserved2Bit << 6) | (versionNumber << 1) | currentNextIndicator); //version_number
-    /* The section_number shall be incremented by 1 with each additional section with the same
-       table_id, service_id, transport_stream_id, and original_network_id. In this case, the sub_table may be 
-       structured as a number of segments.
-     */
-    ptr = ptr + Write8(ptr, secNumber);      //section_number
-    ptr = ptr + Write8(ptr, lastSecNumber);  //last_section_number
-    ptr = ptr + Write16(ptr, transportStreamId); //transport_stream_id
-    ptr = ptr + Write16(ptr, originalNetworkId); //original_network_id
-    ptr = ptr + Write8(ptr, lastSecNumber);  //segment_last_section_number
-    ptr = ptr + Write8(ptr, tableId);       //????
-
-    assert(ptr <= buffer + bufferSize);
-    return (ptr - buffer);
-}
-
-size_t EitTable::MakeCodes2(Var2 &var2, uchar_t *buffer, size_t bufferSize,
-                            size_t var2MaxSize, size_t var2Offset) const
-{
-    uchar_t *ptr = buffer;
-
-    ptr = ptr + var2.MakeCodes(ptr, var2MaxSize, var2Offset);
-
-    assert(ptr <= buffer + bufferSize);
-    return (ptr - buffer);
-}
-
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Deleter.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/PacketHelper.h"
+#include "Include/Foundation/Converter.h"
+#include "Include/Foundation/Crc32.h"
+#include "Include/Foundation/Time.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+#include "Eit.h"
+#include "ModelRegistry.h"
+using namespace std;
+
+/* max section number of schedule of a service, all sections of the service are indexed
+   and counted by SectionNumber.
+ */
+#define MaxEitScheduleSectionNumber 255
+
+static bool eitSegmentation = false;
+static time_t eitHorizon = 0;
+
+void SiTableInterface::SetEitSegmentation(bool enabled)
+{
+    eitSegmentation = enabled;
+}
+
+void SiTableInterface::SetEitHorizon(time_t horizon)
+{
+    eitHorizon = horizon;
+}
+
+SiTableInterface * SiTableInterface::CreateEitInstance(TableId tableId, ServiceId serviceId, Version versionNumber,
+                                                       TsId transportStreamId, NetId originalNetworkId)
+{
+    return new EitTable(tableId, serviceId, versionNumber, transportStreamId, originalNetworkId);
+}
+
+/**********************public function**********************/
+uint32_t ConvertDateToMjd(uint32_t year, uint32_t month, uint32_t day)
+{
+    uint32_t l = (month == 1 || month == 2) ? 1 : 0;
+    return (14956 + day + (uint32_t)((year - l) * 365.25) + (uint32_t)((month + 1 + l * 12) * 30.6001));
+}
+
+void ConvertMjdToDate(uint32_t mjd, uint32_t &year, uint32_t &month, uint32_t &day)
+{
+     year  = (uint32_t)((mjd - 15078.2) / 365.25);
+     month = (uint32_t)((mjd - 14956.1 - uint32_t(year * 365.25)) / 30.6001);
+     day   = mjd - 14956 - uint32_t(year * 365.25) - uint32_t(month * 30.6001);
+     uint_t k = (month == 14 || month == 15) ? 1 : 0;
+     year = year + k;
+     month = month - 1 - k * 12;
+}
+
+/**********************class EitEvent**********************/
+EitEvent::EitEvent(EventId eventId, const char *startTime, time_t duration, 
+                   uint16_t runningStatus, uint16_t freeCaMode, size_t descriptorOffset)
+    : startTime(ConvertStrToTime(startTime)), duration((uint32_t)duration), 
+      descriptorOffset((uint32_t)descriptorOffset), eventId(eventId), 
+      statusAndDescriptorSize((runningStatus << 13) | (freeCaMode << 12))
+{
+    tm localTime, gmtTime;  
+    ConvertStrToTm(startTime, localTime);
+    ConvertUtcToGmt(localTime, gmtTime);
+
+    uint32_t year, month, day, hour, minute, second;
+    year = gmtTime.tm_year;
+    month = gmtTime.tm_mon + 1;
+    day = gmtTime.tm_mday;
+    hour = gmtTime.tm_hour;
+    minute = gmtTime.tm_min;
+    second = gmtTime.tm_sec;
+
+    uint64_t mjdDate = ConvertDateToMjd(year, month, day);
+    uint64_t bcdTime = ((hour / 10) << 20) | ((hour % 10) << 16) 
+                | ((minute / 10) << 12) | ((minute % 10) << 8) 
+                | ((second / 10) << 4) | (second % 10);
+
+    chrono::seconds total(duration);
+    chrono::hours hours = chrono::duration_cast<chrono::hours>(total);
+    chrono::minutes minutes = chrono::duration_cast<chrono::minutes>(total - hours);
+    chrono::seconds seconds = chrono::duration_cast<chrono::seconds>(total - hours - minutes);
+
+    uint64_t bcdDuration = ((hours.count() / 10) << 20) | ((hours.count() % 10) << 16) 
+        | ((minutes.count() / 10) << 12) | ((minutes.count() % 10) << 8) 
+        | ((seconds.count() / 10) << 4) | (seconds.count() % 10);
+    startTimeAndDuration = (((mjdDate << 24) | (bcdTime)) << 24) | (bcdDuration & 0xFFFFFF);
+}
+
+size_t EitEvent::GetCodesSize() const
+{
+    size_t size = GetDescriptorSize() + sizeof(event_information_section_detail);
+    assert(size <= MaxEitEventContentSize);
+    return size;
+}
+
+size_t EitEvent::GetDescriptorOffset() const
+{
+    return descriptorOffset;
+}
+
+size_t EitEvent::GetDescriptorSize() const
+{
+    return statusAndDescriptorSize & 0xFFF;
+}
+
+time_t EitEvent::GetDuration() const
+{
+    return duration;
+}
+
+time_t EitEvent::GetEndTime() const
+{
+    return startTime + duration;
+}
+
+EventId EitEvent::GetEventId() const
+{
+    return eventId;
+}
+
+time_t EitEvent::GetStartTime() const
+{
+    return startTime;
+}
+
+size_t EitEvent::MakeCodes(const uchar_t *descriptors, uchar_t *buffer, size_t bufferSize) const
+{
+    uchar_t *ptr = buffer;
+    size_t size = GetCodesSize();
+    assert(size <= bufferSize);
+    
+    ptr = ptr + Write16(ptr, eventId);
+    ptr = ptr + Write64(ptr, startTimeAndDuration);
+    ptr = ptr + Write16(ptr, statusAndDescriptorSize);
+    ptr = ptr + Write(ptr, bufferSize - (ptr - buffer), descriptors + descriptorOffset, GetDescriptorSize());
+    
+    assert(ptr - buffer == size);
+    return (ptr - buffer);
+}
+
+void EitEvent::SetDescriptor(size_t descriptorOffset, size_t descriptorSize)
+{
+    assert(descriptorSize <= MaxEitEventDescriptorSize);
+    this->descriptorOffset = (uint32_t)descriptorOffset;
+    /* never let the size spill into running_status and free_CA_mode. */
+    statusAndDescriptorSize = (statusAndDescriptorSize & 0xF000) | (uint16_t)(descriptorSize & 0xFFF);
+}
+
+/**********************class EitEvents**********************/
+EitEvents::EitEvents()
+    : garbageSize(0), fingerprint(0), sealed(false)
+{
+    AllocProxy();
+}
+
+EitEvents::~EitEvents()
+{
+    FreeProxy();
+}
+
+void EitEvents::AddEvent(EventId eventId, const char *startTime, 
+                         time_t duration, uint16_t runningStatus, uint16_t freeCaMode)
+{
+    EitEvent eitEvent(eventId, startTime, duration, runningStatus, freeCaMode, descriptors.size());
+
+    /* events are sorted by start time, upstream sends them in order mostly, an event out of
+       order is inserted after the events which start earlier or at same time.
+     */
+    vector<EitEvent>::iterator position = eitEvents.end();
+    if (!eitEvents.empty() && eitEvent.GetStartTime() < eitEvents.back().GetStartTime())
+    {
+        position = upper_bound(eitEvents.begin(), eitEvents.end(), eitEvent, CompareEitEventStartTime());
+        size_t index = position - eitEvents.begin();
+        for (auto &iter: eventIndex)
+        {
+            if (iter.second >= index)
+            {
+                ++iter.second;
+            }
+        }
+    }
+
+    if (!sealed)
+    {
+        /* insert() keeps the first event if event_id is duplicated, same as find_if(). */
+        eventIndex.insert(make_pair(eventId, position - eitEvents.begin()));
+    }
+    eitEvents.insert(position, eitEvent);
+
+    fingerprint = XxHash::CalculateHash((const uchar_t*)&eventId, sizeof(eventId), fingerprint);
+    fingerprint = XxHash::CalculateHash((const uchar_t*)startTime, strlen(startTime), fingerprint);
+    fingerprint = XxHash::CalculateHash((const uchar_t*)&duration, sizeof(duration), fingerprint);
+    fingerprint = XxHash::CalculateHash((const uchar_t*)&runningStatus, sizeof(runningStatus), fingerprint);
+    fingerprint = XxHash::CalculateHash((const uchar_t*)&freeCaMode, sizeof(freeCaMode), fingerprint);
+}
+
+void EitEvents::AddEventDescriptor(uint16_t eventId, const Descriptor &descriptor)
+{
+    vector<EitEvent>::iterator iter;
+    unordered_map<EventId, size_t>::const_iterator index = eventIndex.find(eventId);
+    if (index != eventIndex.end())
+    {
+        iter = eitEvents.begin() + index->second;
+    }
+    else
+    {
+        iter = find_if(eitEvents.begin(), eitEvents.end(), CompareEitEventId(eventId));
+    }
+    assert(iter != eitEvents.end());
+
+    /* descriptors_loop_length is 12 bits, and the event must fit in one section. */
+    size_t descriptorSize = descriptor.GetCodesSize();
+    if (iter->GetDescriptorSize() + descriptorSize > MaxEitEventDescriptorSize)
+    {
+        errstrm << "descriptors of event " << eventId << " are longer than "
+            << MaxEitEventDescriptorSize << " bytes, descriptor is dropped." << endl;
+        return;
+    }
+
+    size_t offset = iter->GetDescriptorOffset();
+    size_t size = iter->GetDescriptorSize();
+    size_t tail = descriptors.size();
+    if (offset + size != tail)
+    {
+        /* descriptors of current event are not at the end of the arena (some other event 
+           got descriptors after it), move them to the end so they keep contiguous. 
+         */
+        descriptors.resize(tail + size);
+        if (size != 0)
+        {
+            memcpy(descriptors.data() + tail, descriptors.data() + offset, size);
+        }
+        garbageSize = garbageSize + size;
+        offset = tail;
+    }
+
+    descriptors.resize(offset + size + descriptorSize);
+    descriptor.MakeCodes(descriptors.data() + offset + size, descriptorSize);
+    iter->SetDescriptor(offset, size + descriptorSize);
+    fingerprint = XxHash::CalculateHash((const uchar_t*)&eventId, sizeof(eventId), fingerprint);
+    fingerprint = XxHash::CalculateHash(descriptors.data() + offset + size, descriptorSize, fingerprint);
+
+    if (garbageSize > descriptors.size() / 2)
+    {
+        CompactDescriptors();
+    }
+}
+
+void EitEvents::AddViewer(const EitTable *viewer)
+{
+    viewers.push_back(viewer);
+}
+
+EitEvents * EitEvents::Clone() const
+{
+    assert(sealed);
+    EitEvents *clone = new EitEvents;
+    clone->eitEvents = eitEvents;
+    clone->descriptors = descriptors;
+    clone->garbageSize = garbageSize;
+    clone->fingerprint = fingerprint;
+    clone->sealed = sealed;
+    return clone;
+}
+
+/* Input and Outpu  decision table.
+TableId     offset                                   return value
+-------     ---------------------------------        -------------------------
+0x4e, 0x4f  0                                        size of "0 ~ (MaxEventNumberIn1EitPfTable - 1)"
+0x4e, 0x4f  0 + (MaxEventNumberIn1EitPfTable - 1)    size of "(MaxEventNumberIn1EitPfTable-1) ~ (MaxEventNumberIn1EitPfTable*2-1)"
+0x4e, 0x4f  0 + (MaxEventNumberIn1EitPfTable - 1)    0
+...
+...
+ */
+size_t EitEvents::GetCodesSize(size_t maxSize, size_t offset, 
+                               uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const
+{
+    size_t size = 0;
+    uint_t eventNumber = 0;
+    
+    /* events after the first maxEventNumberInAllSection events are not packed. */
+    vector<EitEvent>::const_iterator iter, end; 
+    end = eitEvents.begin() + std::min((size_t)maxEventNumberInAllSection, eitEvents.size());
+    for (iter = Seek(offset, maxEventNumberInAllSection); iter < end; ++iter)
+    {
+        if (size + iter->GetCodesSize() > maxSize)
+        {
+            //at lest 1 EitEvent is counted.
+            assert(size != 0);
+            break;
+        }
+        size = size + iter->GetCodesSize();  
+        if (++eventNumber == maxEventNumberIn1Section)
+        {
+            //we have packed MaxEventNumberIn1EitPfTable event in current section or previous section.
+            break;
+        }
+    }
+
+    return size; 
+}
+
+time_t EitEvents::GetEndTime() const
+{
+    return (eitEvents.empty() ? 0 : eitEvents.front().GetEndTime());
+}
+
+size_t EitEvents::GetEventNumber() const
+{
+    return eitEvents.size();
+}
+
+size_t EitEvents::GetEventNumber(time_t time) const
+{
+    return upper_bound(eitEvents.begin(), eitEvents.end(), time, CompareEitEventStartTime()) - eitEvents.begin();
+}
+
+size_t EitEvents::GetEventOffset(size_t index) const
+{
+    assert(index <= eitEvents.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < index; ++i)
+    {
+        offset = offset + eitEvents[i].GetCodesSize();
+    }
+    return offset;
+}
+
+uint64_t EitEvents::GetFingerprint() const
+{
+    return fingerprint;
+}
+
+time_t EitEvents::GetStartTime(size_t index) const
+{
+    assert(index < eitEvents.size());
+    return eitEvents[index].GetStartTime();
+}
+
+void EitEvents::GetSections(size_t maxSize, TableId tableId, uint_t maxEventNumber, 
+                            std::vector<EitSection> &sections) const
+{
+    size_t offset = 0;
+
+    sections.clear();
+    vector<EitEvent>::const_iterator iter, end; 
+    end = eitEvents.begin() + std::min((size_t)maxEventNumber, eitEvents.size());
+    for (iter = eitEvents.begin(); iter != end; offset = offset + iter->GetCodesSize(), ++iter)
+    {
+        if (sections.empty() || sections.back().size + iter->GetCodesSize() > maxSize)
+        {
+            if (sections.size() == MaxEitScheduleSectionNumber)
+            {
+                errstrm << "too many eit schedule sections, events from " << iter->GetEventId()
+                    << " are dropped." << endl;
+                break;
+            }
+
+            EitSection section;
+            section.tableId = tableId;
+            section.sectionNumber = (SectionNumber)sections.size();
+            section.startTime = iter->GetStartTime();
+            section.offset = offset;
+            section.size = 0;
+            section.firstEventId = iter->GetEventId();
+            section.eventNumber = 0;
+            sections.push_back(section);
+        }
+        sections.back().size = sections.back().size + iter->GetCodesSize();
+        ++sections.back().eventNumber;
+    }
+
+    /* same as SiTableTemplate, the first section exists even if it is empty. */
+    if (sections.empty())
+    {
+        EitSection section;
+        section.tableId = tableId;
+        section.sectionNumber = 0;
+        section.startTime = 0;
+        section.offset = 0;
+        section.size = 0;
+        section.firstEventId = 0;
+        section.eventNumber = 0;
+        sections.push_back(section);
+    }
+
+    for (auto &section: sections)
+    {
+        section.lastSectionNumber = sections.back().sectionNumber;
+        section.segmentLastSectionNumber = sections.back().sectionNumber;
+        section.lastTableId = tableId;
+    }
+}
+
+void EitEvents::GetSegments(time_t origin, TableId firstTableId, uint_t maxEventNumber, 
+                            std::vector<EitSection> &sections) const
+{
+    /* pass 1: pack events into sections of their segments, segment of an event is decided by 
+       the start time, events started before origin are put into segment 0, events are sorted
+       by start time, an event never goes back to an earlier segment.
+     */
+    vector<EitSection> packed;
+    vector<uint_t> segmentOf;
+    size_t offset = 0;
+    uint_t sectionNumberInSegment = 0;
+    uint_t maxSegment = EitSegmentNumberIn1Table * MaxEitScheduleTableNumber;
+    uint_t fullSegment = UINT_MAX;    //segment whose sections are all used.
+
+    sections.clear();
+    vector<EitEvent>::const_iterator iter, end; 
+    end = eitEvents.begin() + std::min((size_t)maxEventNumber, eitEvents.size());
+    for (iter = eitEvents.begin(); iter != end; offset = offset + iter->GetCodesSize(), ++iter)
+    {
+        time_t startTime = iter->GetStartTime();
+        uint_t segment = (startTime < origin ? 0 : (uint_t)((startTime - origin) / EitSegmentDuration));
+        if (!segmentOf.empty())
+        {
+            segment = std::max(segment, segmentOf.back());
+        }
+        if (segment >= maxSegment)
+        {
+            break;
+        }
+
+        if (segment == fullSegment)
+        {
+            /* a section covers continuous events, no later event of a full segment is 
+               appended to its last section.
+             */
+            continue;
+        }
+
+        if (segmentOf.empty() || segment != segmentOf.back())
+        {
+            sectionNumberInSegment = 0;
+        }
+        else if (packed.back().size + iter->GetCodesSize() <= MaxEitEventContentSize)
+        {
+            packed.back().size = packed.back().size + iter->GetCodesSize();
+            ++packed.back().eventNumber;
+            continue;
+        }
+        else if (++sectionNumberInSegment == MaxSectionNumberIn1Segment)
+        {
+            /* the segment is full, drop the remaining events of the segment. */
+            --sectionNumberInSegment;
+            fullSegment = segment;
+            errstrm << "eit schedule segment " << segment << " is full, events from " 
+                << iter->GetEventId() << " of the segment are dropped." << endl;
+            continue;
+        }
+
+        EitSection section;
+        section.tableId = firstTableId + segment / EitSegmentNumberIn1Table;
+        section.sectionNumber = (segment % EitSegmentNumberIn1Table) * MaxSectionNumberIn1Segment 
+            + sectionNumberInSegment;
+        section.startTime = startTime;
+        section.offset = offset;
+        section.size = iter->GetCodesSize();
+        section.firstEventId = iter->GetEventId();
+        section.eventNumber = 1;
+        packed.push_back(section);
+        segmentOf.push_back(segment);
+    }
+
+    /* pass 2: every segment of the sub_tables before the last segment is present, an empty
+       segment is signalled by an empty section, a service without event has 1 empty section.
+     */
+    uint_t lastSegment = (segmentOf.empty() ? 0 : segmentOf.back());
+    size_t index = 0;
+    for (uint_t segment = 0; segment <= lastSegment; ++segment)
+    {
+        size_t first = index;
+        while (index < packed.size() && segmentOf[index] == segment)
+        {
+            ++index;
+        }
+
+        size_t number = std::max(index - first, (size_t)1);
+        if (sections.size() + number > MaxEitScheduleSectionNumber)
+        {
+            errstrm << "too many eit schedule sections, segments from " << segment 
+                << " are dropped." << endl;
+            break;
+        }
+
+        if (first == index)
+        {
+            EitSection section;
+            section.tableId = firstTableId + segment / EitSegmentNumberIn1Table;
+            section.sectionNumber = (segment % EitSegmentNumberIn1Table) * MaxSectionNumberIn1Segment;
+            section.startTime = origin + (time_t)segment * EitSegmentDuration;
+            section.offset = 0;
+            section.size = 0;
+            section.firstEventId = 0;
+            section.eventNumber = 0;
+            sections.push_back(section);
+        }
+        else
+        {
+            sections.insert(sections.end(), packed.begin() + first, packed.begin() + index);
+        }
+
+        for (size_t i = sections.size() - number; i < sections.size(); ++i)
+        {
+            sections[i].segmentLastSectionNumber = sections.back().sectionNumber;
+        }
+    }
+
+    /* last_section_number of every sub_table, and last_table_id. */
+    SectionNumber lastSectionNumber = 0;
+    for (size_t i = sections.size(); i != 0; --i)
+    {
+        if (i == sections.size() || sections[i].tableId != sections[i - 1].tableId)
+        {
+            lastSectionNumber = sections[i - 1].sectionNumber;
+        }
+        sections[i - 1].lastSectionNumber = lastSectionNumber;
+        sections[i - 1].lastTableId = sections.back().tableId;
+    }
+}
+
+size_t EitEvents::MakeCodes(uchar_t *buffer, size_t bufferSize, size_t offset,
+                            uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const
+{
+    uchar_t *ptr = buffer;  
+    uint_t eventNumber = 0;
+
+    vector<EitEvent>::const_iterator iter, end;
+    end = eitEvents.begin() + std::min((size_t)maxEventNumberInAllSection, eitEvents.size());
+    for (iter = Seek(offset, maxEventNumberInAllSection); iter < end; ++iter)
+    {
+        if (ptr + iter->GetCodesSize() > buffer + bufferSize)
+        {
+            //at lest 1 EitEvent is counted.
+            assert(ptr != buffer);
+            break;
+        }
+        ptr = ptr + iter->MakeCodes(descriptors.data(), ptr, buffer + bufferSize - ptr);    
+        if (++eventNumber == maxEventNumberIn1Section)
+        {
+            //we have packed MaxEventNumberIn1EitPfTable event in current section or previous section.
+            break;
+        }
+    }
+
+    return (ptr - buffer);
+}
+   
+bool EitEvents::IsSealed() const
+{
+    return sealed;
+}
+
+bool EitEvents::RemoveOutOfDateEvent()
+{
+    time_t curTime = time(nullptr); 
+    vector<EitEvent>::iterator iter, end, started;
+
+    /* only the events started before now can be out of date. */
+    started = upper_bound(eitEvents.begin(), eitEvents.end(), curTime, CompareEitEventStartTime());
+    for (end = eitEvents.begin(); end != started; ++end)
+    {
+        if (end->GetEndTime() > curTime)
+        {
+            break;
+        }
+    }
+
+    if (end == eitEvents.begin())
+    {
+        return true;
+    }
+
+    for (iter = eitEvents.begin(); iter != end; ++iter)
+    {
+        garbageSize = garbageSize + iter->GetDescriptorSize();
+    }
+    eitEvents.erase(eitEvents.begin(), end);
+
+    if (!eventIndex.empty())
+    {
+        /* positions of the remaining events were shifted, rebuild the index. */
+        eventIndex.clear();
+        for (size_t i = 0; i < eitEvents.size(); ++i)
+        {
+            eventIndex.insert(make_pair(eitEvents[i].GetEventId(), i));
+        }
+    }
+
+    if (garbageSize > descriptors.size() / 2)
+    {
+        CompactDescriptors();
+    }
+
+    for (auto viewer: viewers)
+    {
+        viewer->Synchronize();
+    }
+    return false;
+}
+
+void EitEvents::RemoveViewer(const EitTable *viewer)
+{
+    viewers.erase(remove(viewers.begin(), viewers.end(), viewer), viewers.end());
+}
+
+void EitEvents::Seal()
+{
+    unordered_map<EventId, size_t>().swap(eventIndex);
+    sealed = true;
+
+    if (garbageSize != 0)
+    {
+        CompactDescriptors();
+    }
+    eitEvents.shrink_to_fit();
+    descriptors.shrink_to_fit();
+}
+
+/* private function */
+void EitEvents::CompactDescriptors()
+{
+    vector<uchar_t> compacted;
+    compacted.reserve(descriptors.size() - garbageSize);
+
+    for (auto &iter: eitEvents)
+    {
+        size_t offset = compacted.size();
+        size_t size = iter.GetDescriptorSize();
+        compacted.insert(compacted.end(), descriptors.begin() + iter.GetDescriptorOffset(),
+                         descriptors.begin() + iter.GetDescriptorOffset() + size);
+        iter.SetDescriptor(offset, size);
+    }
+
+    descriptors.swap(compacted);
+    garbageSize = 0;
+}
+
+vector<EitEvent>::const_iterator EitEvents::Seek(size_t offset, uint_t maxEventNumberInAllSection) const
+{
+    size_t curOffset = 0;
+    uint_t eventNumber = 0;
+
+    vector<EitEvent>::const_iterator iter;
+    for (iter = eitEvents.cbegin(); iter != eitEvents.cend(); ++iter)
+    {   
+        if (eventNumber++ == maxEventNumberInAllSection)
+        {
+            return eitEvents.cend();
+        }
+
+        if (curOffset >= offset)
+            break;
+
+        curOffset = curOffset + iter->GetCodesSize();
+    }
+    assert(curOffset == offset);
+
+    return iter;
+}
+
+/**********************class EitTable**********************/
+EitTable::EitTable(TableId tableId, ServiceId serviceId, Version versionNumber, 
+                   TsId transportStreamId, NetId originalNetworkId)
+    : tableId(tableId), serviceId(serviceId), versionNumber(versionNumber),
+      transportStreamId(transportStreamId), originalNetworkId(originalNetworkId),
+      eitEvents(new EitEvents), eventNumber(0), segmentOrigin(0), schSegmented(false), schSectionsValid(false), 
+      windowEventNumber(0), windowValid(false)
+{
+    UpdateFingerprint(&tableId, sizeof(tableId));
+    UpdateFingerprint(&serviceId, sizeof(serviceId));
+    UpdateVersionFingerprint(&versionNumber, sizeof(versionNumber));
+    UpdateFingerprint(&transportStreamId, sizeof(transportStreamId));
+    UpdateFingerprint(&originalNetworkId, sizeof(originalNetworkId));
+    eitEvents->AddViewer(this);
+}
+
+EitTable::~EitTable()
+{    
+    eitEvents->RemoveViewer(this);
+    if (eitEvents.unique())
+    {
+        ModelRegistry<EitEvents>::GetInstance().Remove(eitEvents.get());
+    }
+}
+
+void EitTable::AddEvent(EventId eventId, const char *startTime, 
+                time_t duration, uint16_t  runningStatus, uint16_t freeCaMode)
+{
+    DetachModel();
+    eitEvents->AddEvent(eventId, startTime, duration, runningStatus, freeCaMode);
+    eventNumber = eitEvents->GetEventNumber();
+    schSectionsValid = false;
+    windowValid = false;
+    pfSections.clear();
+    nextPfSections.clear();
+    UpdateFingerprint(&eventId, sizeof(eventId));
+    UpdateFingerprint(startTime, strlen(startTime));
+    UpdateFingerprint(&duration, sizeof(duration));
+    UpdateFingerprint(&runningStatus, sizeof(runningStatus));
+    UpdateFingerprint(&freeCaMode, sizeof(freeCaMode));
+    ClearCatch();
+}
+
+void EitTable::AddEventDescriptor(EventId eventId, std::string &data)
+{
+    Descriptor* descriptor = CreateDescriptor(data);
+    if (descriptor == nullptr)
+    {
+        errstrm << "we do not support descriptor whose tag = " 
+            << hex << data[0] << data[1] << endl;
+        return;
+    }
+
+    DetachModel();
+    eitEvents->AddEventDescriptor(eventId, *descriptor);
+    schSectionsValid = false;
+    pfSections.clear();
+    nextPfSections.clear();
+    delete descriptor;
+    UpdateFingerprint(&eventId, sizeof(eventId));
+    UpdateFingerprint(data.data(), data.size());
+    ClearCatch();
+}
+
+const uchar_t * EitTable::GetCodes(TableId tableId, TsId tsId, SectionNumber secIndex) const
+{
+    if (GetCodesSize(tableId, tsId, secIndex) == 0)
+    {
+        return nullptr;
+    }
+
+    if (IsPf(tableId, tsId))
+    {
+        return GetPfSections()[secIndex].data();
+    }
+    return GetSchCodes(secIndex).GetCodes();
+}
+
+size_t EitTable::GetCodesSize(TableId tableId, TsId tsId, SectionNumber secIndex) const
+{
+    if (IsPf(tableId, tsId))
+    {
+        const vector<vector<uchar_t>> &sections = GetPfSections();
+        return (secIndex < sections.size() ? sections[secIndex].size() : 0);
+    }
+
+    if (!IsSchedule(tableId, tsId))
+    {
+        return 0;
+    }
+
+    const vector<EitSection> &sections = GetSchSections();
+    if (secIndex >= sections.size())
+    {
+        return 0;
+    }
+    return EitFixedFieldSize + sections[secIndex].size;
+}
+
+SiTableKey EitTable::GetKey() const
+{
+    SiTableKey key = (transportStreamId << 16) | serviceId;
+    return key;
+}
+
+time_t EitTable::GetNextBoundary() const
+{
+    time_t boundary = eitEvents->GetEndTime();
+    uint_t windowNumber = GetWindowEventNumber();
+    if (windowNumber < eitEvents->GetEventNumber())
+    {
+        /* the next event moves into the horizon. */
+        time_t entering = eitEvents->GetStartTime(windowNumber) - eitHorizon;
+        boundary = (boundary == 0 ? entering : std::min(boundary, entering));
+    }
+    if (eitSegmentation)
+    {
+        /* segments move forward at midnight. */
+        time_t midnight = GetSegmentOrigin() + 24 * 3600;
+        boundary = (boundary == 0 ? midnight : std::min(boundary, midnight));
+    }
+    return boundary;
+}
+
+uint_t EitTable::GetSecNumber(TableId tableId, TsId tsId) const
+{
+    if (IsPf(tableId, tsId))
+    {
+        return GetPfSections().size();
+    }
+
+    if (!IsSchedule(tableId, tsId))
+    {
+        return 0;
+    }
+
+    return GetSchSections().size();
+}
+
+time_t EitTable::GetSectionTime(TableId tableId, TsId tsId, SectionNumber secIndex) const
+{
+    if (!IsSchedule(tableId, tsId))
+    {
+        return 0;
+    }
+
+    const vector<EitSection> &sections = GetSchSections();
+    return (secIndex < sections.size() ? sections[secIndex].startTime : 0);
+}
+
+TableId EitTable::GetTableId() const
+{
+    return tableId;
+}
+
+bool EitTable::GetTsId(TsId &tsId) const
+{
+    tsId = transportStreamId;
+    return true;
+}
+
+Version EitTable::GetVersion() const
+{
+    return versionNumber;
+}
+
+void EitTable::Inherit(const SiTableInterface &old)
+{
+    const EitTable *oldTable = dynamic_cast<const EitTable*>(&old);
+    if (oldTable == nullptr || oldTable->tableId != tableId || oldTable->GetKey() != GetKey())
+    {
+        return;
+    }
+
+    /* a schedule section is unchanged if its header (except version_number) and its events
+       are same, the codes of the old section are reused, only the events are encoded to 
+       compare, the header and crc are not.
+     */
+    const vector<EitSection> &oldSections = oldTable->GetSchSections();
+    GetSchSections();
+    bool sameHeader = (oldTable->originalNetworkId == originalNetworkId);
+    bool changed = (!sameHeader || oldSections.size() != schSections.size());
+    size_t number = (sameHeader ? std::min(oldSections.size(), schSections.size()) : 0);
+    vector<uchar_t> events;
+    for (size_t i = 0; i < number; ++i)
+    {
+        EitSection &section = schSections[i];
+        const EitSection &oldSection = oldSections[i];
+        if (section.tableId != oldSection.tableId
+            || section.sectionNumber != oldSection.sectionNumber
+            || section.segmentLastSectionNumber != oldSection.segmentLastSectionNumber
+            || section.lastSectionNumber != oldSection.lastSectionNumber
+            || section.lastTableId != oldSection.lastTableId
+            || section.size != oldSection.size)
+        {
+            changed = true;
+            continue;
+        }
+
+        const SectionRef &oldCodes = oldTable->GetSchCodes(i);
+        events.resize(section.size);
+        if (section.size != 0)
+        {
+            eitEvents->MakeCodes(events.data(), section.size, section.offset, UINT_MAX, UINT_MAX);
+        }
+        if (!equal(events.begin(), events.end(), oldCodes.GetCodes() + (EitFixedFieldSize - sizeof(uint32_t))))
+        {
+            changed = true;
+            continue;
+        }
+        section.codes = oldCodes;
+    }
+
+    /* p/f sections are small, they are compared by codes. */
+    auto sameCodes = [](const vector<uchar_t> &left, const vector<uchar_t> &right) -> bool
+    {
+        /* version_number (byte 5) and crc are not compared. */
+        return (left.size() == right.size()
+            && equal(left.begin(), left.begin() + 5, right.begin())
+            && equal(left.begin() + 6, left.end() - sizeof(uint32_t), right.begin() + 6));
+    };
+    const vector<vector<uchar_t>> &oldPfSections = oldTable->GetPfSections();
+    GetPfSections();
+    if (oldPfSections.size() != pfSections.size() 
+        || !equal(pfSections.begin(), pfSections.end(), oldPfSections.begin(), sameCodes))
+    {
+        changed = true;
+    }
+
+    /* receivers only see a new version_number when the content is changed. */
+    if (!changed)
+    {
+        SetVersion(oldTable->versionNumber);
+    }
+    else if (versionNumber == oldTable->versionNumber)
+    {
+        SetVersion((Version)((versionNumber + 1) & 0x1F));
+    }
+    else
+    {
+        /* the reused sections carry the version of old table. */
+        SetVersion(versionNumber);
+    }
+}
+
+size_t EitTable::MakeCodes(TableId tableId, TsId tsId, uchar_t *buffer, size_t bufferSize,
+                           SectionNumber secIndex) const
+{
+    if (IsPf(tableId, tsId))
+    {
+        const vector<vector<uchar_t>> &sections = GetPfSections();
+        assert(secIndex < sections.size() && sections[secIndex].size() <= bufferSize);
+        memcpy(buffer, sections[secIndex].data(), sections[secIndex].size());
+        return sections[secIndex].size();
+    }
+
+    if (!IsSchedule(tableId, tsId))
+    {
+        return 0;
+    }
+
+    const vector<EitSection> &sections = GetSchSections();
+    assert(secIndex < sections.size());
+    const SectionRef &codes = GetSchCodes(secIndex);
+    assert(codes.GetCodesSize() <= bufferSize);
+    memcpy(buffer, codes.GetCodes(), codes.GetCodesSize());
+    return codes.GetCodesSize();
+}
+
+void EitTable::RefreshCatch()
+{
+    /* all tables sharing the model drop the sections of the removed events at once
+       (Synchronize()), this table included.
+     */
+    if (!eitEvents->RemoveOutOfDateEvent())
+    {
+        /* the model is not same as its fingerprint any more. */
+        ModelRegistry<EitEvents>::GetInstance().Remove(eitEvents.get());
+    }
+
+    /* segment 0 starts at midnight, all segments move forward at midnight.  the eit
+       segmentation may be changed after the sections were made.
+     */
+    bool segmentChanged = false;
+    if (schSectionsValid && (schSegmented != eitSegmentation 
+                             || (schSegmented && segmentOrigin != GetSegmentOrigin())))
+    {
+        schSectionsValid = false;
+        segmentChanged = true;
+    }
+
+    /* events move into the horizon as time goes. */
+    bool windowChanged = false;
+    if (windowValid)
+    {
+        uint_t number = windowEventNumber;
+        windowValid = false;
+        windowChanged = (GetWindowEventNumber() != number);
+    }
+
+    if (!windowChanged && !segmentChanged)
+    {
+        return;
+    }
+    schSectionsValid = false;
+    ClearCatch();
+}
+
+void EitTable::Seal()
+{
+    if (eitEvents->IsSealed())
+    {
+        return;
+    }
+
+    /* an identical model of another table (eit other of the service, ...) is adopted, 
+       the model of this table is released.
+     */
+    eitEvents->Seal();
+    SetModel(ModelRegistry<EitEvents>::GetInstance().Adopt(eitEvents));
+    assert(eitEvents->GetEventNumber() == eventNumber);
+}
+
+void EitTable::SetVersion(Version versionNumber)
+{
+    assert(versionNumber < 32);
+    this->versionNumber = versionNumber;
+
+    /* the encoded sections are patched instead of being encoded again. */
+    for (auto &section: schSections)
+    {
+        if (!section.codes.IsEmpty())
+        {
+            PatchVersion(section.codes, versionNumber, GetSchSourceKey(section));
+        }
+    }
+    for (auto &codes: pfSections)
+    {
+        PatchVersion(codes, versionNumber);
+    }
+    for (auto &codes: nextPfSections)
+    {
+        PatchVersion(codes, versionNumber);
+    }
+}
+
+/* private function */
+void EitTable::DetachModel()
+{
+    if (!eitEvents->IsSealed())
+    {
+        return;
+    }
+
+    if (eitEvents.unique())
+    {
+        ModelRegistry<EitEvents>::GetInstance().Remove(eitEvents.get());
+    }
+    else
+    {
+        SetModel(shared_ptr<EitEvents>(eitEvents->Clone()));
+    }
+}
+
+const vector<EitSection>& EitTable::GetSchSections() const
+{
+    Synchronize();
+    if (schSectionsValid && schSegmented == eitSegmentation)
+    {
+        return schSections;
+    }
+
+    vector<EitSection> sections;
+    if (eitSegmentation)
+    {
+        segmentOrigin = GetSegmentOrigin();
+        eitEvents->GetSegments(segmentOrigin, tableId, GetWindowEventNumber(), sections);
+    }
+    else
+    {
+        eitEvents->GetSections(VarSize - GetVar1().GetCodesSize(), tableId, GetWindowEventNumber(), sections);
+    }
+
+    /* only the changed sections are encoded again, codes of an unchanged section are reused. */
+    auto earlier = [](const EitSection &left, const EitSection &right) -> bool
+    {
+        return (left.tableId < right.tableId 
+            || (left.tableId == right.tableId && left.sectionNumber < right.sectionNumber));
+    };
+    for (auto &section: sections)
+    {
+        vector<EitSection>::iterator old = lower_bound(schSections.begin(), schSections.end(), section, earlier);
+        if (old != schSections.end() && !earlier(section, *old)
+            && old->segmentLastSectionNumber == section.segmentLastSectionNumber
+            && old->lastSectionNumber == section.lastSectionNumber
+            && old->lastTableId == section.lastTableId
+            && old->firstEventId == section.firstEventId
+            && old->eventNumber == section.eventNumber
+            && old->size == section.size)
+        {
+            section.codes.Swap(old->codes);
+        }
+    }
+
+    schSections.swap(sections);
+    schSegmented = eitSegmentation;
+    schSectionsValid = true;
+    return schSections;
+}
+
+const SectionRef& EitTable::GetSchCodes(size_t index) const
+{
+    EitSection &section = schSections[index];
+    if (!section.codes.IsEmpty())
+    {
+        return section.codes;
+    }
+
+    /* the events of a section are decided by the table content and by firstEventId, 
+       eventNumber of the section, an identical table of other network shares the
+       section instead of making it again.
+     */
+    uint64_t source = GetSchSourceKey(section);
+    SectionStore &store = SectionStore::GetInstance();
+    section.codes = SectionRef(store.Find(source));
+    if (!section.codes.IsEmpty())
+    {
+        return section.codes;
+    }
+
+    size_t size = EitFixedFieldSize + section.size;
+    vector<uchar_t> codes(size);
+    uchar_t *ptr = codes.data();
+    WriteHelper<uint16_t> writeHelper(ptr + sizeof(TableId), ptr + sizeof(TableId) + sizeof(TableSize));
+    ptr = ptr + Write8(ptr, section.tableId);
+    ptr = ptr + Write16(ptr, 0); //section_length, written by writeHelper
+    ptr = ptr + Write16(ptr, serviceId);
+    ptr = ptr + Write8(ptr, (Reserved2Bit << 6) | (versionNumber << 1) | 1); //current_next_indicator
+    ptr = ptr + Write8(ptr, section.sectionNumber);
+    ptr = ptr + Write8(ptr, section.lastSectionNumber);
+    ptr = ptr + Write16(ptr, transportStreamId);
+    ptr = ptr + Write16(ptr, originalNetworkId);
+    ptr = ptr + Write8(ptr, section.segmentLastSectionNumber);
+    ptr = ptr + Write8(ptr, section.lastTableId);
+    if (section.size != 0)
+    {
+        ptr = ptr + eitEvents->MakeCodes(ptr, section.size, section.offset, UINT_MAX, UINT_MAX);
+    }
+    writeHelper.Write((SectionSyntaxIndicator << 15) | (Reserved1Bit << 14) | (Reserved2Bit << 12), ptr + 4);
+    ptr = ptr + Write32(ptr, Crc32::CalculateCrc(codes.data(), ptr - codes.data()));
+    assert(ptr == codes.data() + size);
+
+    section.codes = SectionRef(store.Add(codes.data(), size, source));
+    return section.codes;
+}
+
+time_t EitTable::GetSegmentOrigin()
+{
+    time_t now = time(nullptr);
+    return now - now % (24 * 3600);
+}
+
+const vector<vector<uchar_t>>& EitTable::GetPfSections() const
+{
+    Synchronize();
+    if (pfSections.empty())
+    {
+        MakePfSections(0, pfSections);
+    }
+
+    /* p/f after the present event ends, made in advance. */
+    if (nextPfSections.empty() && eitEvents->GetEventNumber() != 0)
+    {
+        MakePfSections(1, nextPfSections);
+    }
+    return pfSections;
+}
+
+bool EitTable::IsPf(TableId tableId, TsId tsId) const
+{
+    return ((tableId == EitActualPfTableId || tableId == EitOtherPfTableId)
+        && CheckTableId(tableId) && CheckTsId(tsId));
+}
+
+void EitTable::MakePfSections(size_t first, vector<vector<uchar_t>> &sections) const
+{
+    TableId pfTableId = (tableId == EitActualSchTableId ? EitActualPfTableId : EitOtherPfTableId);
+    /* events before "first" are counted by EitEvents, so the max event number is shifted. */
+    uint_t maxEventNumber = (uint_t)first + MaxEventNumberInAllEitPfSection;
+    size_t offset = eitEvents->GetEventOffset(first);
+
+    /* same packing as SiTableTemplate, the first section exists even if it is empty. */
+    vector<size_t> sizes;
+    size_t size = eitEvents->GetCodesSize(VarSize, offset, MaxEventNumberIn1EitPfSection, maxEventNumber);
+    do
+    {
+        sizes.push_back(size);
+        offset = offset + size;
+    } while ((size = eitEvents->GetCodesSize(VarSize, offset, MaxEventNumberIn1EitPfSection, maxEventNumber)) != 0);
+
+    sections.assign(sizes.size(), vector<uchar_t>());
+    offset = eitEvents->GetEventOffset(first);
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        vector<uchar_t> &codes = sections[i];
+        codes.resize(FixedSize + sizes[i]);
+
+        uchar_t *ptr = codes.data();
+        uchar_t *end = codes.data() + codes.size();
+        WriteHelper<uint16_t> writeHelper(ptr + sizeof(TableId), ptr + sizeof(TableId) + sizeof(TableSize));
+        ptr = ptr + MakeCodes1(pfTableId, ptr, end - ptr, 0, (SectionNumber)i, (SectionNumber)(sizes.size() - 1));
+        if (sizes[i] != 0)
+        {
+            ptr = ptr + eitEvents->MakeCodes(ptr, sizes[i], offset, MaxEventNumberIn1EitPfSection, maxEventNumber);
+        }
+        writeHelper.Write((SectionSyntaxIndicator << 15) | (Reserved1Bit << 14) | (Reserved2Bit << 12), ptr + 4);
+        ptr = ptr + Write32(ptr, Crc32::CalculateCrc(codes.data(), ptr - codes.data()));
+        assert(ptr == end);
+        offset = offset + sizes[i];
+    }
+}
+
+bool EitTable::IsSchedule(TableId tableId, TsId tsId) const
+{
+    return ((tableId == EitActualSchTableId || tableId == EitOtherSchTableId)
+        && CheckTableId(tableId) && CheckTsId(tsId));
+}
+
+void EitTable::PatchVersion(vector<uchar_t> &codes, Version versionNumber)
+{
+    /* version_number is in byte 5, the crc covers all bytes except the last 4. */
+    size_t crcOffset = codes.size() - sizeof(uint32_t);
+    uchar_t value = (uchar_t)((Reserved2Bit << 6) | (versionNumber << 1) | 1);
+    uint32_t crc;
+    Read32(codes.data() + crcOffset, crc);
+    Write32(codes.data() + crcOffset, Crc32::PatchCrc(crc, crcOffset, 5, codes[5], value));
+    codes[5] = value;
+}
+
+void EitTable::PatchVersion(SectionRef &codes, Version versionNumber, uint64_t source)
+{
+    uchar_t value = (uchar_t)((Reserved2Bit << 6) | (versionNumber << 1) | 1);
+    if (codes.GetCodes()[5] == value)
+    {
+        return;
+    }
+
+    /* the section may be shared, the patched codes are a new section of the store, which
+       can be found by the source key of the new version, as if it was made by GetSchCodes().
+     */
+    SectionStore &store = SectionStore::GetInstance();
+    SectionRef found(store.Find(source));
+    if (!found.IsEmpty())
+    {
+        codes.Swap(found);
+        return;
+    }
+
+    vector<uchar_t> patched(codes.GetCodes(), codes.GetCodes() + codes.GetCodesSize());
+    PatchVersion(patched, versionNumber);
+    codes = SectionRef(store.Add(patched.data(), patched.size(), source));
+}
+
+uint64_t EitTable::GetSchSourceKey(const EitSection &section) const
+{
+    uint64_t keys[] = {GetFingerprint(), versionNumber, section.tableId, section.sectionNumber,
+                       section.segmentLastSectionNumber, section.lastSectionNumber, section.lastTableId,
+                       section.firstEventId, section.eventNumber, section.size};
+    uint64_t source = XxHash::CalculateHash((const uchar_t*)keys, sizeof(keys));
+    return (source == 0 ? 1 : source);    //0 means no source key.
+}
+
+uint_t EitTable::GetWindowEventNumber() const
+{
+    Synchronize();
+    if (!windowValid)
+    {
+        size_t number = (eitHorizon == 0 ? eitEvents->GetEventNumber() 
+                                         : eitEvents->GetEventNumber(time(nullptr) + eitHorizon));
+        windowEventNumber = (uint_t)number;
+        windowValid = true;
+    }
+    return windowEventNumber;
+}
+
+void EitTable::Synchronize() const
+{
+    size_t number = eitEvents->GetEventNumber();
+    if (number == eventNumber)
+    {
+        return;
+    }
+
+    /* the events are removed through another table sharing the model. */
+    IncreaseChangeNumber();
+    schSectionsValid = false;
+    windowValid = false;
+    /* only the present event ended, the prepared p/f sections are the new ones. */
+    if (number + 1 == eventNumber && !nextPfSections.empty())
+    {
+        pfSections.swap(nextPfSections);
+    }
+    else
+    {
+        pfSections.clear();
+    }
+    nextPfSections.clear();
+    eventNumber = number;
+}
+
+void EitTable::SetModel(const shared_ptr<EitEvents> &model)
+{
+    if (model == eitEvents)
+    {
+        return;
+    }
+
+    eitEvents->RemoveViewer(this);
+    eitEvents = model;
+    eitEvents->AddViewer(this);
+}
+
+/* protected function */
+bool EitTable::CheckTableId(TableId tableId) const
+{
+    if (this->tableId == EitActualSchTableId)
+    {
+        if (tableId != EitActualPfTableId && tableId != EitActualSchTableId)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (tableId != EitOtherPfTableId && tableId != EitOtherSchTableId)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool EitTable::CheckTsId(TsId tsid) const
+{
+    return (tsid == this->transportStreamId);
+}
+
+const EitTable::Var1& EitTable::GetVar1() const
+{
+    return varHelper;
+}
+
+EitTable::Var2 EitTable::GetVar2(TableId tableId) const
+{
+    if (tableId == EitActualPfTableId || tableId == EitOtherPfTableId)
+    {
+        return Var2(*eitEvents, MaxEventNumberIn1EitPfSection, MaxEventNumberInAllEitPfSection);
+    }
+
+    return Var2(*eitEvents, UINT_MAX, GetWindowEventNumber());
+}
+
+size_t EitTable::MakeCodes1(TableId tableId, uchar_t *buffer, size_t bufferSize, size_t var1Size,
+                            SectionNumber secNumber, SectionNumber lastSecNumber) const
+{
+    uchar_t *ptr = buffer;
+    
+    //section_syntax_indicator:1 + reserved_future_use1:1 + reserved1:2 + section_length:12
+    TableSize pseudoSize = 0;
+    ptr = ptr + WriteBuffer(ptr, tableId);
+    ptr = ptr + WriteBuffer(ptr, pseudoSize); 
+    ptr = ptr + WriteBuffer(ptr, serviceId); //service_id
+
+    uchar_t currentNextIndicator = 1;
+    ptr = ptr + Write8(ptr, (Reserved2Bit << 6) | (versionNumber << 1) | currentNextIndicator); //version_number
+    /* The section_number shall be incremented by 1 with each additional section with the same
+       table_id, service_id, transport_stream_id, and original_network_id. In this case, the sub_table may be 
+       structured as a number of segments.
+     */
+    ptr = ptr + Write8(ptr, secNumber);      //section_number
+    ptr = ptr + Write8(ptr, lastSecNumber);  //last_section_number
+    ptr = ptr + Write16(ptr, transportStreamId); //transport_stream_id
+    ptr = ptr + Write16(ptr, originalNetworkId); //original_network_id
+    ptr = ptr + Write8(ptr, lastSecNumber);  //segment_last_section_number
+    ptr = ptr + Write8(ptr, tableId);       //????
+
+    assert(ptr <= buffer + bufferSize);
+    return (ptr - buffer);
+}
+
+size_t EitTable::MakeCodes2(Var2 &var2, uchar_t *buffer, size_t bufferSize,
+                            size_t var2MaxSize, size_t var2Offset) const
+{
+    uchar_t *ptr = buffer;
+
+    ptr = ptr + var2.MakeCodes(ptr, var2MaxSize, var2Offset);
+
+    assert(ptr <= buffer + bufferSize);
+    return (ptr - buffer);
+}
+
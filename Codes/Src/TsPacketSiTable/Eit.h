@@ -1,252 +1,405 @@
-#ifndef _Eit_h_
-#define _Eit_h_
-
-#include "Include/Foundation/Time.h"
-#include "Descriptor.h"       //Descriptor 
-#include "TransportStream.h"  //TransportStream
-#include "SiTableTemplate.h"
-
-#pragma pack(push, 1)
-struct event_information_section
-{
-    uchar_t table_id: 8;
-
-    uint16_t section_syntax_indicator: 1;
-    uint16_t reserved_future_use: 1;
-    uint16_t reserved1: 2;
-    uint16_t section_length: 12;
-
-    uint16_t service_id: 16;
-
-    uchar_t reserved2: 2;
-    uchar_t version_number: 5;
-    uchar_t current_next_indicator: 1;
-
-    uchar_t section_number: 8;
-    uchar_t last_section_number: 8;
-    uint16_t transport_stream_id: 16;
-    uint16_t original_network_id: 16;
-    uchar_t  segment_last_section_number: 8;
-    uchar_t  last_table_id: 8;
-    /*  ... ... */
-    uint32_t CRC_32: 32; 
-};
-
-struct event_information_section_detail
-{
-    //for (i=0;i<N;i++)
-    //{
-    uint16_t event_id:           16;       //uimsbf     --
-
-    uint64_t start_time:         40;
-    uint64_t duration:           24;
-
-    uint16_t running_status:             3;  //uimsbf 
-    uint16_t free_CA_mode:               1;  //bslbf
-    uint16_t descriptors_loop_length:    12; //uimsbf        --
-    //    for (j=0;j<N;j++)
-    //    {
-    //        descriptor()
-    //    }
-    //}
-};
-#pragma pack(pop)
-#define EitFixedFieldSize sizeof(event_information_section)
-//MaxEitEventContentSize = 4078
-#define MaxEitEventContentSize (MaxEitSectionLength - EitFixedFieldSize)
-//sizeof(event_information_section_detail) = 12
-#define MaxEitEventDescriptorSize (MaxEitEventContentSize - sizeof(event_information_section_detail))
-
-/**********************class EitEvent**********************/
-class EitEvent
-{
-public:
-    EitEvent(EventId eventId, const char *startTime, 
-             time_t duration, uint16_t runningStatus, uint16_t freeCaMode);
-    ~EitEvent();
-   
-    void AddDescriptor(Descriptor *descriptor);
-
-    size_t GetCodesSize() const;
-    time_t GetDuration() const;
-    EventId GetEventId() const;
-    const std::string &GetStartTime() const;
-
-    size_t MakeCodes(uchar_t *buffer, size_t bufferSize) const; 
-
-private:
-    EventId  eventId;  
-    std::string  startTime;
-    time_t   duration; 
-    uint16_t runningStatus;
-    uint16_t freeCaMode;
-
-    Descriptors descriptors;
-};
-
-class CompareEitEventId: std::unary_function<EitEvent, bool>
-{
-public:
-    CompareEitEventId(EventId eventId)
-        : eventId(eventId)
-    {}
-
-    result_type operator()(const argument_type &eitEvent)
-    {
-        return (result_type)(eitEvent.GetEventId() == eventId);
-    }
-
-    result_type operator()(const argument_type *eitEvent)
-    {
-        return this->operator()(*eitEvent);
-    }
-
-private:
-    uint16_t eventId;
-};
-
-class CompareEitEventTime: std::unary_function<EitEvent, bool>
-{
-public:
-    CompareEitEventTime(time_t time)
-        : time(time)
-    {}
-
-    result_type operator()(const argument_type &eitEvent)
-    {
-        time_t eventTime = ConvertStrToTime(eitEvent.GetStartTime().c_str()) + eitEvent.GetDuration();
-        
-        return eventTime < time;
-    }
-
-    result_type operator()(const argument_type *eitEvent)
-    {
-        return this->operator()(*eitEvent);
-    }
-
-private:
-    time_t time;
-};
-
-
-/**********************class EitEvents**********************/
-class EitEvents: public ContainerBase
-{
-public:
-    EitEvents();
-    ~EitEvents();
-    
-    void AddEvent(EitEvent *eitEvent);
-    void AddEventDescriptor(uint16_t eventId, Descriptor *descriptor);    
-    
-    // ContainerBase function. construct proxy from _Alnod
-    void AllocProxy()
-    {
-        myProxy = new ContainerProxy;
-        myProxy->myContainer = this;
-    }
-    // ContainerBase function, destroy proxy.
-    void FreeProxy()
-    {
-        OrphanAll();
-        delete myProxy;
-        myProxy = nullptr;
-    }
-
-    size_t GetCodesSize(size_t maxSize, size_t offset, 
-                        uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const;
-    size_t MakeCodes(uchar_t *buffer, size_t bufferSize, size_t offset,
-                     uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const;
-    
-    /* remove out-of-date event 
-       Return Values:  
-           true if events is same between befor and after.
-           false if some out-of-date event was deleted.
-     */
-    bool RemoveOutOfDateEvent();
-
-private:
-    std::list<EitEvent *>::const_iterator Seek(size_t offset, uint_t maxEventNumberInAllSection) const;
-
-private:
-    std::list<EitEvent *> eitEvents;
-};
-
-template<typename EitEvents>
-class EitEventsBinder: public IteratorBase 
-{
-public:
-    EitEventsBinder(const EitEvents &eitEvents, uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection)
-        : eitEvents(eitEvents),
-          maxEventNumberIn1Section(maxEventNumberIn1Section),
-          maxEventNumberInAllSection(maxEventNumberInAllSection)
-    {
-        const ContainerBase *container = &eitEvents;
-        this->Adopt(container); 
-    }
-
-    size_t GetCodesSize(size_t maxSize, size_t offset) const
-    {
-#ifdef _DEBUG
-        assert(this->GetContainer() != nullptr);
-#endif
-        return eitEvents.GetCodesSize(maxSize, offset, maxEventNumberIn1Section, maxEventNumberInAllSection);
-    }
-
-    size_t MakeCodes(uchar_t *buffer, size_t bufferSize, size_t offset) const
-    {
-#ifdef _DEBUG
-        assert(this->GetContainer() != nullptr);
-#endif
-        return eitEvents.MakeCodes(buffer, bufferSize, offset, maxEventNumberIn1Section, maxEventNumberInAllSection);
-    }
-
-private:
-    const EitEvents &eitEvents;
-    uint_t maxEventNumberIn1Section;
-    uint_t maxEventNumberInAllSection;
-};
-
-/**********************class EitTable**********************/
-class EitTable: public SiTableTemplate<VarHelper, EitEventsBinder<EitEvents>>
-{
-public:
-    friend class SiTableInterface;
-    ~EitTable(); 
-
-    void AddEvent(EventId eventId, const char *startTime, 
-                  time_t duration, uint16_t runningStatus, uint16_t freeCaMode);
-    void AddEventDescriptor(EventId eventId, std::string &data);
-    
-    SiTableKey GetKey() const;
-    TableId GetTableId() const;
-    void RefreshCatch();
-
-protected:
-    bool CheckTableId(TableId tableId) const;
-    bool CheckTsId(TsId tsid) const;
-    size_t GetFixedSize() const;
-    size_t GetVarSize() const;
-    const Var1& GetVar1() const;
-    Var2 GetVar2(TableId tableId) const;
-    size_t MakeCodes1(TableId tableId, uchar_t *buffer, size_t bufferSize, size_t var1Size,
-                      SectionNumber secNumber, SectionNumber lastSecNumber) const;    
-    size_t MakeCodes2(Var2 &var2, uchar_t *buffer, size_t bufferSize,
-                      size_t var2MaxSize, size_t var2Offset) const; 
-
-private:
-    EitTable(TableId tableId, ServiceId serviceId, Version versionNumber, 
-             TsId transportStreamId, NetId originalNetworkId);
-
-private:    
-    TableId tableId;
-    ServiceId serviceId;
-    Version versionNumber;
-    TsId    transportStreamId;
-    NetId   originalNetworkId;
-
-    VarHelper varHelper;
-    EitEvents eitEvents;
-};
-
+#ifndef _Eit_h_
+#define _Eit_h_
+
+#include "Include/Foundation/Time.h"
+#include "Descriptor.h"       //Descriptor 
+#include "TransportStream.h"  //TransportStream
+#include "SiTableTemplate.h"
+
+#pragma pack(push, 1)
+struct event_information_section
+{
+    uchar_t table_id: 8;
+
+    uint16_t section_syntax_indicator: 1;
+    uint16_t reserved_future_use: 1;
+    uint16_t reserved1: 2;
+    uint16_t section_length: 12;
+
+    uint16_t service_id: 16;
+
+    uchar_t reserved2: 2;
+    uchar_t version_number: 5;
+    uchar_t current_next_indicator: 1;
+
+    uchar_t section_number: 8;
+    uchar_t last_section_number: 8;
+    uint16_t transport_stream_id: 16;
+    uint16_t original_network_id: 16;
+    uchar_t  segment_last_section_number: 8;
+    uchar_t  last_table_id: 8;
+    /*  ... ... */
+    uint32_t CRC_32: 32; 
+};
+
+struct event_information_section_detail
+{
+    //for (i=0;i<N;i++)
+    //{
+    uint16_t event_id:           16;       //uimsbf     --
+
+    uint64_t start_time:         40;
+    uint64_t duration:           24;
+
+    uint16_t running_status:             3;  //uimsbf 
+    uint16_t free_CA_mode:               1;  //bslbf
+    uint16_t descriptors_loop_length:    12; //uimsbf        --
+    //    for (j=0;j<N;j++)
+    //    {
+    //        descriptor()
+    //    }
+    //}
+};
+#pragma pack(pop)
+#define EitFixedFieldSize sizeof(event_information_section)
+//MaxEitEventContentSize = 4078
+#define MaxEitEventContentSize (MaxEitSectionLength - EitFixedFieldSize)
+//sizeof(event_information_section_detail) = 12
+#define MaxEitEventDescriptorSize (MaxEitEventContentSize - sizeof(event_information_section_detail))
+
+/* ETSI TS 101 211, 4.1.4 EIT schedule structure: every schedule table_id covers 4 days,
+   which is divided into 32 segments of 3 hours, a segment has at most 8 sections.
+ */
+#define EitSegmentDuration          (3 * 3600)
+#define EitSegmentNumberIn1Table    32
+#define MaxSectionNumberIn1Segment  8
+#define MaxEitScheduleTableNumber   16
+
+/**********************class EitSection**********************/
+/* a section of eit schedule, the events of the section are [offset, offset + size) of
+   EitEvents.
+ */
+struct EitSection
+{
+    TableId       tableId;
+    SectionNumber sectionNumber;
+    SectionNumber segmentLastSectionNumber;
+    SectionNumber lastSectionNumber;
+    TableId       lastTableId;
+    time_t        startTime;    //start time of the first event, or of the segment if it is empty.
+    size_t        offset;
+    size_t        size;
+    EventId       firstEventId;
+    size_t        eventNumber;
+    SectionRef    codes;        //catch of the section codes, shared in SectionStore.
+};
+
+/**********************class EitEvent**********************/
+/* Fixed size event header, EitEvents keeps them in a contiguous vector.
+   The descriptors of an event are stored in the descriptor arena of EitEvents,
+   the header just records [descriptorOffset, descriptorOffset + descriptors_loop_length).
+   start_time and duration are converted to MJD/BCD once, when the event is added.
+ */
+class EitEvent
+{
+public:
+    EitEvent(EventId eventId, const char *startTime, time_t duration, 
+             uint16_t runningStatus, uint16_t freeCaMode, size_t descriptorOffset);
+   
+    size_t GetCodesSize() const;
+    size_t GetDescriptorOffset() const;
+    size_t GetDescriptorSize() const;
+    time_t GetDuration() const;
+    time_t GetEndTime() const;
+    EventId GetEventId() const;
+    time_t GetStartTime() const;
+
+    /* descriptors: base address of the descriptor arena. */
+    size_t MakeCodes(const uchar_t *descriptors, uchar_t *buffer, size_t bufferSize) const; 
+    void SetDescriptor(size_t descriptorOffset, size_t descriptorSize);
+
+private:
+    uint64_t startTimeAndDuration; //start_time: 40 + duration: 24
+    time_t   startTime;
+    uint32_t duration;
+    uint32_t descriptorOffset;
+    EventId  eventId;
+    uint16_t statusAndDescriptorSize; //running_status: 3 + free_CA_mode: 1 + descriptors_loop_length: 12
+};
+
+class CompareEitEventId: std::unary_function<EitEvent, bool>
+{
+public:
+    CompareEitEventId(EventId eventId)
+        : eventId(eventId)
+    {}
+
+    result_type operator()(const argument_type &eitEvent)
+    {
+        return (result_type)(eitEvent.GetEventId() == eventId);
+    }
+
+    result_type operator()(const argument_type *eitEvent)
+    {
+        return this->operator()(*eitEvent);
+    }
+
+private:
+    uint16_t eventId;
+};
+
+class CompareEitEventTime: std::unary_function<EitEvent, bool>
+{
+public:
+    CompareEitEventTime(time_t time)
+        : time(time)
+    {}
+
+    result_type operator()(const argument_type &eitEvent)
+    {
+        return eitEvent.GetEndTime() < time;
+    }
+
+    result_type operator()(const argument_type *eitEvent)
+    {
+        return this->operator()(*eitEvent);
+    }
+
+private:
+    time_t time;
+};
+
+/* order of EitEvent by start time. */
+class CompareEitEventStartTime
+{
+public:
+    bool operator()(const EitEvent &left, const EitEvent &right) const
+    {
+        return left.GetStartTime() < right.GetStartTime();
+    }
+
+    bool operator()(time_t left, const EitEvent &right) const
+    {
+        return left < right.GetStartTime();
+    }
+
+    bool operator()(const EitEvent &left, time_t right) const
+    {
+        return left.GetStartTime() < right;
+    }
+};
+
+/**********************class EitEvents**********************/
+class EitTable;
+class EitEvents: public ContainerBase
+{
+public:
+    EitEvents();
+    ~EitEvents();
+    
+    void AddEvent(EventId eventId, const char *startTime, 
+                  time_t duration, uint16_t runningStatus, uint16_t freeCaMode);
+    void AddEventDescriptor(uint16_t eventId, const Descriptor &descriptor);    
+    /* the tables which view the model, they are told at once when RemoveOutOfDateEvent()
+       removes events, so a table sharing the model doesn't wait for its own refresh.
+     */
+    void AddViewer(const EitTable *viewer);
+    /* a sealed copy without viewers, for a table which changes a shared model. */
+    EitEvents * Clone() const;
+    
+    // ContainerBase function. construct proxy from _Alnod
+    void AllocProxy()
+    {
+        myProxy = new ContainerProxy;
+        myProxy->myContainer = this;
+    }
+    // ContainerBase function, destroy proxy.
+    void FreeProxy()
+    {
+        OrphanAll();
+        delete myProxy;
+        myProxy = nullptr;
+    }
+
+    size_t GetCodesSize(size_t maxSize, size_t offset, 
+                        uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const;
+    /* end time of the first event, 0 if there is no event. */
+    time_t GetEndTime() const;
+    size_t GetEventNumber() const;
+    /* number of events which start at or before "time". */
+    size_t GetEventNumber(time_t time) const;
+    /* offset of event "index" in the codes of all events. */
+    size_t GetEventOffset(size_t index) const;
+    /* hash of the parameters of every AddXxx() call, key of ModelRegistry. */
+    uint64_t GetFingerprint() const;
+    time_t GetStartTime(size_t index) const;
+    /* sections of not segmented schedule of the first "maxEventNumber" events, the events
+       are packed same as GetCodesSize(maxSize, offset, UINT_MAX, maxEventNumber).
+     */
+    void GetSections(size_t maxSize, TableId tableId, uint_t maxEventNumber, 
+                     std::vector<EitSection> &sections) const;
+    /* sections of segmented schedule of the first "maxEventNumber" events, "origin" is the
+       start time of segment 0 (midnight of today, UTC), "firstTableId" is 0x50 or 0x60.
+     */
+    void GetSegments(time_t origin, TableId firstTableId, uint_t maxEventNumber, 
+                     std::vector<EitSection> &sections) const;
+    size_t MakeCodes(uchar_t *buffer, size_t bufferSize, size_t offset,
+                     uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection) const;
+    bool IsSealed() const;
+    
+    /* remove out-of-date event 
+       Return Values:  
+           true if events is same between befor and after.
+           false if some out-of-date event was deleted.
+     */
+    bool RemoveOutOfDateEvent();
+    void RemoveViewer(const EitTable *viewer);
+    /* called when all events and descriptors were added, release the builder index. */
+    void Seal();
+
+private:
+    /* drop the descriptor bytes which are not referenced by any event any more. */
+    void CompactDescriptors();
+    std::vector<EitEvent>::const_iterator Seek(size_t offset, uint_t maxEventNumberInAllSection) const;
+
+private:
+    /* sorted by start time, the first event is the present one (or the following one
+       if no event is running).
+     */
+    std::vector<EitEvent> eitEvents;
+    /* descriptor arena, descriptors of all events are stored here one by one. */
+    std::vector<uchar_t> descriptors;
+    /* size of the bytes in descriptor arena which are not referenced by any event. */
+    size_t garbageSize;
+    /* builder index, event_id -> position in eitEvents, only valid before Seal(). */
+    std::unordered_map<EventId, size_t> eventIndex;
+    uint64_t fingerprint;
+    bool sealed;
+    std::vector<const EitTable*> viewers;
+};
+
+template<typename EitEvents>
+class EitEventsBinder: public IteratorBase 
+{
+public:
+    EitEventsBinder(const EitEvents &eitEvents, uint_t maxEventNumberIn1Section, uint_t maxEventNumberInAllSection)
+        : eitEvents(eitEvents),
+          maxEventNumberIn1Section(maxEventNumberIn1Section),
+          maxEventNumberInAllSection(maxEventNumberInAllSection)
+    {
+        const ContainerBase *container = &eitEvents;
+        this->Adopt(container); 
+    }
+
+    size_t GetCodesSize(size_t maxSize, size_t offset) const
+    {
+#ifdef _DEBUG
+        assert(this->GetContainer() != nullptr);
+#endif
+        return eitEvents.GetCodesSize(maxSize, offset, maxEventNumberIn1Section, maxEventNumberInAllSection);
+    }
+
+    size_t MakeCodes(uchar_t *buffer, size_t bufferSize, size_t offset) const
+    {
+#ifdef _DEBUG
+        assert(this->GetContainer() != nullptr);
+#endif
+        return eitEvents.MakeCodes(buffer, bufferSize, offset, maxEventNumberIn1Section, maxEventNumberInAllSection);
+    }
+
+private:
+    const EitEvents &eitEvents;
+    uint_t maxEventNumberIn1Section;
+    uint_t maxEventNumberInAllSection;
+};
+
+/**********************class EitTable**********************/
+class EitTable: public SiTableTemplate<EitTable, VarHelper, EitEventsBinder<EitEvents>>
+{
+public:
+    friend class SiTableInterface;
+    friend class SiTableTemplate<EitTable, VarHelper, EitEventsBinder<EitEvents>>;
+    friend class EitEvents;
+    enum {FixedSize = EitFixedFieldSize, VarSize = MaxEitEventContentSize};
+    ~EitTable(); 
+
+    void AddEvent(EventId eventId, const char *startTime, 
+                  time_t duration, uint16_t runningStatus, uint16_t freeCaMode);
+    void AddEventDescriptor(EventId eventId, std::string &data);
+    
+    const uchar_t * GetCodes(TableId tableId, TsId tsId, SectionNumber secIndex) const;
+    size_t GetCodesSize(TableId tableId, TsId tsId, SectionNumber secIndex) const;
+    SiTableKey GetKey() const;
+    time_t GetNextBoundary() const;
+    uint_t GetSecNumber(TableId tableId, TsId tsId) const;
+    time_t GetSectionTime(TableId tableId, TsId tsId, SectionNumber secIndex) const;
+    TableId GetTableId() const;
+    bool GetTsId(TsId &tsId) const;
+    Version GetVersion() const;
+    void Inherit(const SiTableInterface &old);
+    size_t MakeCodes(TableId tableId, TsId tsId, uchar_t *buffer, size_t bufferSize,
+                     SectionNumber secIndex) const;
+    void RefreshCatch();
+    void Seal();
+    void SetVersion(Version versionNumber);
+
+protected:
+    bool CheckTableId(TableId tableId) const;
+    bool CheckTsId(TsId tsid) const;
+    const Var1& GetVar1() const;
+    Var2 GetVar2(TableId tableId) const;
+    size_t MakeCodes1(TableId tableId, uchar_t *buffer, size_t bufferSize, size_t var1Size,
+                      SectionNumber secNumber, SectionNumber lastSecNumber) const;    
+    size_t MakeCodes2(Var2 &var2, uchar_t *buffer, size_t bufferSize,
+                      size_t var2MaxSize, size_t var2Offset) const; 
+
+private:
+    EitTable(TableId tableId, ServiceId serviceId, Version versionNumber, 
+             TsId transportStreamId, NetId originalNetworkId);
+    /* the model is going to be changed, a shared model is copied first. */
+    void DetachModel();
+    /* view "model" instead of current one. */
+    void SetModel(const std::shared_ptr<EitEvents> &model);
+    const std::vector<EitSection>& GetSchSections() const;
+    /* codes of schedule section "index", encoded at the first call. */
+    const SectionRef& GetSchCodes(size_t index) const;
+    /* source key of a schedule section in SectionStore, for current version_number. */
+    uint64_t GetSchSourceKey(const EitSection &section) const;
+    static time_t GetSegmentOrigin();
+    bool IsSchedule(TableId tableId, TsId tsId) const;
+    /* change version_number of section codes, the crc is patched. */
+    static void PatchVersion(std::vector<uchar_t> &codes, Version versionNumber);
+    static void PatchVersion(SectionRef &codes, Version versionNumber, uint64_t source);
+    /* number of events in the horizon, only these events are encoded in schedule. */
+    uint_t GetWindowEventNumber() const;
+    /* events of the model were removed (by any table sharing it), drop the sections made
+       from the removed events.  called by EitEvents::RemoveOutOfDateEvent().
+     */
+    void Synchronize() const;
+    const std::vector<std::vector<uchar_t>>& GetPfSections() const;
+    bool IsPf(TableId tableId, TsId tsId) const;
+    /* make all p/f sections, the present event is eitEvents[first]. */
+    void MakePfSections(size_t first, std::vector<std::vector<uchar_t>> &sections) const;
+
+private:    
+    TableId tableId;
+    ServiceId serviceId;
+    Version versionNumber;
+    TsId    transportStreamId;
+    NetId   originalNetworkId;
+
+    VarHelper varHelper;
+    /* the model may be shared with other tables (eit actual and eit other of the service,
+       see ModelRegistry), only the header fields belong to the table.
+     */
+    std::shared_ptr<EitEvents> eitEvents;
+    /* number of events in the model when the sections of the table were made. */
+    mutable size_t eventNumber;
+    /* sections of schedule, built by GetSchSections(), the codes of a section are reused
+       after rebuilding if the section is not changed.
+     */
+    mutable std::vector<EitSection> schSections;
+    mutable time_t segmentOrigin;
+    mutable bool   schSegmented;    //schSections is segmented.
+    mutable bool   schSectionsValid;
+    /* p/f sections of now, and p/f sections after the present event ends. the later ones 
+       are made in advance, and swapped in by RefreshCatch() at the event boundary.
+     */
+    mutable std::vector<std::vector<uchar_t>> pfSections;
+    mutable std::vector<std::vector<uchar_t>> nextPfSections;
+    /* events which start within the horizon, updated by RefreshCatch(). */
+    mutable uint_t windowEventNumber;
+    mutable bool   windowValid;
+};
+
 #endif
\ No newline at end of file
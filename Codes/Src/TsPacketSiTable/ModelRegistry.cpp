@@ -0,0 +1,19 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/PacketHelper.h"
+#include "Include/Foundation/Crc32.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+#include "Eit.h"
+#include "Sdt.h"
+#include "ModelRegistry.h"
+using namespace std;
+
+size_t SiTableInterface::GetModelNumber()
+{
+    return ModelRegistry<EitEvents>::GetInstance().GetModelNumber()
+        + ModelRegistry<SdtServices>::GetInstance().GetModelNumber();
+}
@@ -0,0 +1,80 @@
+#ifndef _ModelRegistry_h_
+#define _ModelRegistry_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+/**********************class ModelRegistry**********************/
+/* registry of sealed table models (EitEvents, SdtServices), keyed by the fingerprint of
+   the model content.  the schedule of a service is loaded as eit actual for its own ts
+   and again as eit other for the neighbours (same for the services of sdt actual and sdt
+   other), usually from separate files.  the table sealed later adopts the model of the
+   first one, so one canonical model is kept, and the tables are views of it which differ
+   only in table_id and header fields.
+   the registry doesn't own the models, a model is released by the last table holding it.
+   a model which is going to be changed must be removed from the registry first.
+   Example:
+    std::shared_ptr<EitEvents> eitEvents(new EitEvents);
+    eitEvents->AddEvent(...);
+    ...
+    eitEvents->Seal();
+    eitEvents = ModelRegistry<EitEvents>::GetInstance().Adopt(eitEvents);
+ */
+template<typename Model>
+class ModelRegistry
+{
+public:
+    /* the registry is never deleted, tables may be deleted after static objects at exit. */
+    static ModelRegistry & GetInstance()
+    {
+        static ModelRegistry *instance = new ModelRegistry;
+        return *instance;
+    }
+
+    /* return the registered model which has same fingerprint as "model", "model" itself
+       is registered and returned if there is none.
+     */
+    std::shared_ptr<Model> Adopt(const std::shared_ptr<Model> &model)
+    {
+        std::weak_ptr<Model> &registered = models[model->GetFingerprint()];
+        std::shared_ptr<Model> adopted = registered.lock();
+        if (adopted == nullptr)
+        {
+            registered = model;
+            return model;
+        }
+        return adopted;
+    }
+
+    size_t GetModelNumber() const
+    {
+        return models.size();
+    }
+
+    /* "model" is going to be changed or released, it can't be adopted any more. */
+    void Remove(const Model *model)
+    {
+        auto iter = models.find(model->GetFingerprint());
+        if (iter == models.end())
+        {
+            return;
+        }
+
+        std::shared_ptr<Model> registered = iter->second.lock();
+        if (registered == nullptr || registered.get() == model)
+        {
+            models.erase(iter);
+        }
+    }
+
+private:
+    ModelRegistry() {}
+    ~ModelRegistry() {}
+
+private:
+    std::unordered_map<uint64_t, std::weak_ptr<Model>> models;  //fingerprint -> model
+};
+
+#endif
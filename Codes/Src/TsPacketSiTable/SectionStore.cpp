@@ -0,0 +1,197 @@
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/XxHash.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+#include "SectionStore.h"
+using namespace std;
+
+void SiTableInterface::PutSectionStore(std::ostream& os)
+{
+    os << SectionStore::GetInstance();
+}
+
+/**********************class SectionStore**********************/
+/* public function */
+SectionStore & SectionStore::GetInstance()
+{
+    static SectionStore *instance = new SectionStore;
+    return *instance;
+}
+
+const SectionStore::Section * SectionStore::Add(const uchar_t *codes, size_t size, uint64_t source)
+{
+    /* the length is the seed, so the key is hash plus length. */
+    uint64_t hash = XxHash::CalculateHash(codes, size, size);
+    Section *section = nullptr;
+    auto range = sections.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (iter->second->codes.size() == size && memcmp(iter->second->codes.data(), codes, size) == 0)
+        {
+            section = iter->second;
+            break;
+        }
+    }
+
+    if (section == nullptr)
+    {
+        section = new Section;
+        section->codes.assign(codes, codes + size);
+        section->hash = hash;
+        section->refNumber = 0;
+        sections.insert(make_pair(hash, section));
+        this->size = this->size + size;
+    }
+
+    if (source != 0 && sources.insert(make_pair(source, section)).second)
+    {
+        section->sources.push_back(source);
+    }
+
+    AddRef(section);
+    return section;
+}
+
+void SectionStore::AddRef(const Section *section)
+{
+    ++const_cast<Section*>(section)->refNumber;
+    referencedSize = referencedSize + section->codes.size();
+}
+
+const SectionStore::Section * SectionStore::Find(uint64_t source)
+{
+    unordered_map<uint64_t, Section*>::iterator iter = sources.find(source);
+    if (iter == sources.end())
+    {
+        return nullptr;
+    }
+
+    AddRef(iter->second);
+    return iter->second;
+}
+
+void SectionStore::Release(const Section *section)
+{
+    assert(section->refNumber != 0);
+    referencedSize = referencedSize - section->codes.size();
+    if (--const_cast<Section*>(section)->refNumber != 0)
+    {
+        return;
+    }
+
+    /* the last reference, the section and its source keys are removed. */
+    for (auto source: section->sources)
+    {
+        sources.erase(source);
+    }
+
+    auto range = sections.equal_range(section->hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (iter->second == section)
+        {
+            sections.erase(iter);
+            break;
+        }
+    }
+    size = size - section->codes.size();
+    delete section;
+}
+
+size_t SectionStore::GetSectionNumber() const
+{
+    return sections.size();
+}
+
+uint64_t SectionStore::GetSize() const
+{
+    return size;
+}
+
+uint64_t SectionStore::GetReferencedSize() const
+{
+    return referencedSize;
+}
+
+void SectionStore::Put(std::ostream& os) const
+{
+    os << "sections = " << sections.size()
+       << ", size = " << size
+       << ", referenced size = " << referencedSize
+       << ", saved = " << (referencedSize - size);
+}
+
+/* private function */
+SectionStore::SectionStore()
+    : size(0), referencedSize(0)
+{
+}
+
+SectionStore::~SectionStore()
+{
+}
+
+/**********************class SectionRef**********************/
+SectionRef::SectionRef()
+    : section(nullptr)
+{
+}
+
+SectionRef::SectionRef(const SectionStore::Section *section)
+    : section(section)
+{
+}
+
+SectionRef::SectionRef(const SectionRef &value)
+    : section(value.section)
+{
+    if (section != nullptr)
+    {
+        SectionStore::GetInstance().AddRef(section);
+    }
+}
+
+SectionRef::~SectionRef()
+{
+    Clear();
+}
+
+SectionRef & SectionRef::operator = (const SectionRef &value)
+{
+    SectionRef copy(value);
+    Swap(copy);
+    return *this;
+}
+
+void SectionRef::Clear()
+{
+    if (section != nullptr)
+    {
+        SectionStore::GetInstance().Release(section);
+        section = nullptr;
+    }
+}
+
+const uchar_t * SectionRef::GetCodes() const
+{
+    return (section == nullptr ? nullptr : section->codes.data());
+}
+
+size_t SectionRef::GetCodesSize() const
+{
+    return (section == nullptr ? 0 : section->codes.size());
+}
+
+bool SectionRef::IsEmpty() const
+{
+    return (section == nullptr);
+}
+
+void SectionRef::Swap(SectionRef &value)
+{
+    std::swap(section, value.section);
+}
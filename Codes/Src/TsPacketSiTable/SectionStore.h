@@ -0,0 +1,94 @@
+#ifndef _SectionStore_h_
+#define _SectionStore_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+
+/**********************class SectionStore**********************/
+/* content addressed store of section codes, shared by the tables of all networks and all
+   files.  byte-identical sections (sdt other, eit other of same service in several
+   networks ...) are kept once, keyed by xxhash and length of the codes, the tables hold
+   SectionRef instead of private buffers.
+   a section can also be found by a source key, the hash of everything the codes are made
+   from (table fingerprint, version, section number ...), so a table which is identical
+   with another one does not make the section again.
+   Example:
+    SectionRef ref(SectionStore::GetInstance().Find(source));
+    if (ref.IsEmpty())
+    {
+        make codes ...
+        ref = SectionRef(SectionStore::GetInstance().Add(codes, size, source));
+    }
+    memcpy(buffer, ref.GetCodes(), ref.GetCodesSize());
+ */
+class SectionStore
+{
+public:
+    struct Section
+    {
+        std::vector<uchar_t>  codes;
+        uint64_t              hash;
+        uint_t                refNumber;
+        std::vector<uint64_t> sources;  //source keys of the section.
+    };
+
+    /* the store is never deleted, tables may be deleted after static objects at exit. */
+    static SectionStore & GetInstance();
+    /* return the section of "codes" with a reference added, the codes are copied only if
+       the store has no identical section.  source 0 means no source key.
+     */
+    const Section * Add(const uchar_t *codes, size_t size, uint64_t source);
+    void AddRef(const Section *section);
+    /* return the section of source key with a reference added, nullptr if not found. */
+    const Section * Find(uint64_t source);
+    void Release(const Section *section);
+
+    size_t   GetSectionNumber() const;
+    /* bytes kept by the store, and bytes if every reference had a private copy. */
+    uint64_t GetSize() const;
+    uint64_t GetReferencedSize() const;
+    void Put(std::ostream& os) const;
+
+private:
+    SectionStore();
+    ~SectionStore();
+
+private:
+    std::unordered_multimap<uint64_t, Section*> sections;  //hash -> section
+    std::unordered_map<uint64_t, Section*> sources;        //source key -> section
+    uint64_t size;
+    uint64_t referencedSize;
+};
+
+inline std::ostream& operator << (std::ostream& os, const SectionStore& value)
+{
+    value.Put(os);
+    return os;
+}
+
+/**********************class SectionRef**********************/
+/* a reference to a section of SectionStore, released when the SectionRef is destroyed. */
+class SectionRef
+{
+public:
+    SectionRef();
+    /* take over a reference returned by SectionStore::Add() or Find(). */
+    explicit SectionRef(const SectionStore::Section *section);
+    SectionRef(const SectionRef &value);
+    ~SectionRef();
+
+    SectionRef & operator = (const SectionRef &value);
+
+    void Clear();
+    const uchar_t * GetCodes() const;
+    size_t GetCodesSize() const;
+    bool IsEmpty() const;
+    void Swap(SectionRef &value);
+
+private:
+    const SectionStore::Section *section;
+};
+
+#endif
@@ -1,219 +1,283 @@
-#ifndef _SiTableTemplate_h_
-#define _SiTableTemplate_h_
-
-#include "Include/Foundation/SystemInclude.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-/* TsPacketSiTable */
-#include "Include/TsPacketSiTable/SiTableInterface.h"
-
-#include "CatchHelper.h"
-
-/**********************class VarHelper**********************/
-class VarHelper
-{
-public:
-    VarHelper() {};
-    ~VarHelper() {};
-
-    size_t GetCodesSize() const 
-    { 
-        return 0;
-    }
-
-    size_t MakeCodes(uchar_t *buffer, size_t bufferSize) const
-    {
-        return 0;
-    }
-};
-
-/**********************class SiTableTemplate**********************/
-template <typename Var1Type, typename Var2Type>
-class SiTableTemplate: public SiTableInterface
-{
-public:
-    typedef Var1Type Var1;
-    typedef Var2Type Var2;
-    SiTableTemplate() { InitCatch(); }
-    virtual ~SiTableTemplate() { ClearCatch(); }
-
-    virtual size_t GetCodesSize(TableId tableId, TsId tsId, SectionNumber secIndex) const
-    {
-        SectionNumber secNumber = (SectionNumber)GetSecNumber(tableId, tsId);
-        if (secNumber == 0)
-            return 0;
-
-        const Var1 &var1 = GetVar1();
-        Var2 var2 = GetVar2(tableId);
-
-#ifdef UseCatchOptimization
-        CatchId catchId = CatchIdHelper::GetCatchId(tableId, tsId, secIndex);
-        map<CatchId, size_t>::iterator catchIter = codeSizeCatches.find(catchId);
-        if (catchIter != codeSizeCatches.end())
-        {
-            return catchIter->second;
-        }
-#endif
-
-        //we assume all descriptor to be packed in first section.
-        assert(var1.GetCodesSize() <= GetVarSize());
-        //check secIndex is valid.
-        assert(secIndex < secNumber);
-
-        size_t var1Size = var1.GetCodesSize();
-        size_t maxSize = GetVarSize() - var1Size;
-        size_t offset = 0;
-
-        for (SectionNumber i = 0; i < secIndex; ++i)
-        {
-            offset = offset + var2.GetCodesSize(maxSize, offset);
-            var1Size = 0;
-            maxSize = GetVarSize();
-        }
-
-        size_t var2Size = var2.GetCodesSize(maxSize, offset);
-        size_t size = GetFixedSize() + var1Size + var2Size;
-
-#ifdef UseCatchOptimization
-        codeSizeCatches.insert(make_pair(catchId, size));
-#endif
-        return size;
-    }
-
-    virtual uint_t GetSecNumber(TableId tableId, TsId tsId) const
-    {        
-        if (!CheckTableId(tableId) || !CheckTsId(tsId))
-            return 0;
-
-        const Var1 &var1 = GetVar1();
-        Var2 var2 = GetVar2(tableId);
-
-#ifdef UseCatchOptimization
-        CatchId catchId = CatchIdHelper::GetCatchId(tableId, tsId);
-        map<CatchId, uint_t>::iterator catchIter = secNumberCatches.find(catchId);
-        if (catchIter != secNumberCatches.end())
-        {
-            return catchIter->second;
-        }
-#endif
-
-        uint_t secNumber = 1;
-        size_t maxSize = GetVarSize() - var1.GetCodesSize();
-        size_t offset = 0;
-        offset = var2.GetCodesSize(maxSize, offset);
-    
-        size_t size;
-        maxSize = GetVarSize();
-        while ((size = var2.GetCodesSize(maxSize, offset)) != 0)
-        {
-            offset = offset + size;
-            ++secNumber;
-        }
-
-#ifdef UseCatchOptimization
-        secNumberCatches.insert(make_pair(catchId, secNumber));
-#endif
-        return secNumber;
-    }
-
-    virtual size_t MakeCodes(TableId tableId, TsId tsId, 
-                     uchar_t *buffer, size_t bufferSize,
-                     SectionNumber secIndex) const
-    {
-        SectionNumber secNumber = (SectionNumber)GetSecNumber(tableId, tsId);
-        if (secNumber == 0)
-            return 0;        
-
-        const Var1 &var1 = GetVar1();
-        Var2 var2 = GetVar2(tableId);
-
-        size_t size = GetCodesSize(tableId, tsId, secIndex);
-        assert(size <= bufferSize && size != 0);
-
-#ifdef UseCatchOptimization
-        CatchId catchId = CatchIdHelper::GetCatchId(tableId, tsId, secIndex);
-        map<CatchId, uchar_t*>::iterator catchIter = codeCatches.find(catchId);
-        if (catchIter != codeCatches.end())
-        {
-            memcpy(buffer, catchIter->second, size);
-            return size;
-        }
-#endif
-
-        //we assume all descriptor to be packed in first section.
-        assert(var1.GetCodesSize() <= GetVarSize());
-        //check secIndex is valid.
-        assert(secIndex < secNumber);
-                
-        size_t var1Size = var1.GetCodesSize();
-        size_t maxSize = GetVarSize() - var1Size;
-        size_t offset = 0;
-    
-        /* calculate offset */
-        for (SectionNumber i = 0; i < secIndex; ++i)
-        {
-            offset = offset + var2.GetCodesSize(maxSize, offset);
-            var1Size = 0;
-            maxSize = GetVarSize();
-        }
-
-        uchar_t *ptr = buffer;
-        WriteHelper<uint16_t> writeHelper(ptr + sizeof(TableId), ptr + sizeof(TableId) + sizeof(TableSize));
-        ptr = ptr + MakeCodes1(tableId, ptr, buffer + bufferSize - ptr, var1Size, 
-                               secIndex, secNumber - 1);        
-        ptr = ptr + MakeCodes2(var2, ptr, buffer + bufferSize - ptr, maxSize, offset); 
-        writeHelper.Write((SectionSyntaxIndicator << 15) | (Reserved1Bit << 14) | (Reserved2Bit << 12), ptr + 4); 
-        ptr = ptr + Write32(ptr, Crc32::CalculateCrc(buffer, ptr - buffer));
-
-        
-#ifdef UseCatchOptimization
-        uchar_t *codeCatch = new uchar_t[size];
-        memcpy(codeCatch, buffer, size);
-
-        codeCatches.insert(make_pair(catchId, codeCatch));
-#endif
-        assert(size == ptr - buffer);
-        return ptr - buffer;
-    }
-
-protected:
-    void InitCatch()
-    {
-        ClearCatch();
-    }
-
-    void ClearCatch()
-    {
-#ifdef UseCatchOptimization
-        codeSizeCatches.clear();
-        map<CatchId, uchar_t*>::iterator iter;
-        for (iter = codeCatches.begin(); iter != codeCatches.end(); ++iter)
-        {
-            delete[] iter->second;
-        }
-        codeCatches.clear();
-        secNumberCatches.clear();
-#endif
-    }
-
-    virtual bool CheckTableId(TableId tableId) const = 0;
-    virtual bool CheckTsId(TsId tsid) const = 0;
-    virtual size_t GetFixedSize() const = 0;
-    virtual size_t GetVarSize() const = 0;
-    virtual const Var1& GetVar1() const = 0;
-    virtual Var2 GetVar2(TableId tableId) const = 0;
-    virtual size_t MakeCodes1(TableId tableId, uchar_t *buffer, size_t bufferSize, size_t var1Size,
-                              SectionNumber secNumber, SectionNumber lastSecNumber) const = 0;    
-    virtual size_t MakeCodes2(Var2 &var2, uchar_t *buffer, size_t bufferSize,
-                              size_t var2MaxSize, size_t var2Offset) const = 0;    
-
-private:
-#ifdef UseCatchOptimization
-    mutable std::map<CatchId, size_t> codeSizeCatches;
-    mutable std::map<CatchId, uchar_t*> codeCatches;
-    mutable std::map<CatchId, uint_t> secNumberCatches;
-#endif
-};
-
+#ifndef _SiTableTemplate_h_
+#define _SiTableTemplate_h_
+
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Arena.h"
+#include "Include/Foundation/XxHash.h"
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+
+#include "CatchHelper.h"
+#include "SectionStore.h"
+
+/**********************class VarHelper**********************/
+class VarHelper
+{
+public:
+    VarHelper() {};
+    ~VarHelper() {};
+
+    size_t GetCodesSize() const 
+    { 
+        return 0;
+    }
+
+    size_t MakeCodes(uchar_t *buffer, size_t bufferSize) const
+    {
+        return 0;
+    }
+};
+
+/**********************class SiTableTemplate**********************/
+/* Table is the derived table (CRTP), the hooks of the section loops are called through
+   static_cast instead of the virtual table:
+    bool CheckTableId(TableId tableId) const;
+    bool CheckTsId(TsId tsid) const;
+    const Var1& GetVar1() const;
+    Var2 GetVar2(TableId tableId) const;
+    size_t MakeCodes1(...) const;
+    size_t MakeCodes2(...) const;
+   and the section geometry is given by Table::FixedSize and Table::VarSize.
+   the sections of {tableId, tsId} are laid out in one pass with one Var2 binder, the size
+   of every section is then read from the layout.
+ */
+template <typename Table, typename Var1Type, typename Var2Type>
+class SiTableTemplate: public SiTableInterface
+{
+public:
+    typedef Var1Type Var1;
+    typedef Var2Type Var2;
+    SiTableTemplate(): fingerprint(0), contentFingerprint(0), changeNumber(nullptr) { InitCatch(); }
+    virtual ~SiTableTemplate() { ClearCatch(); }
+
+    virtual size_t GetCodesSize(TableId tableId, TsId tsId, SectionNumber secIndex) const
+    {
+        SectionNumber secNumber = (SectionNumber)GetSecNumber(tableId, tsId);
+        if (secNumber == 0)
+            return 0;
+
+        //check secIndex is valid.
+        assert(secIndex < secNumber);
+        return GetLayout(tableId, tsId).sizes[secIndex];
+    }
+
+    virtual uint_t GetSecNumber(TableId tableId, TsId tsId) const
+    {        
+        if (!GetTable().CheckTableId(tableId) || !GetTable().CheckTsId(tsId))
+            return 0;
+
+        return (uint_t)GetLayout(tableId, tsId).sizes.size();
+    }
+
+    virtual const uchar_t * GetCodes(TableId tableId, TsId tsId, SectionNumber secIndex) const
+    {
+        size_t size = GetCodesSize(tableId, tsId, secIndex);
+        if (size == 0)
+            return nullptr;
+
+#ifdef UseCatchOptimization
+        CatchId catchId = CatchIdHelper::GetCatchId(tableId, tsId, secIndex);
+        map<CatchId, SectionRef>::iterator catchIter = codeCatches.find(catchId);
+        if (catchIter != codeCatches.end())
+        {
+            return catchIter->second.GetCodes();
+        }
+
+        /* tables with same fingerprint and version make same sections, the section of
+           an identical table is shared instead of being made again.
+         */
+        SectionStore &store = SectionStore::GetInstance();
+        uint64_t source = GetSourceKey(catchId);
+        SectionRef codeCatch(store.Find(source));
+        if (codeCatch.IsEmpty())
+        {
+            std::vector<uchar_t> codes(size);
+            MakeSection(tableId, tsId, codes.data(), size, secIndex);
+            codeCatch = SectionRef(store.Add(codes.data(), size, source));
+        }
+        assert(codeCatch.GetCodesSize() == size);
+        return codeCatches.insert(make_pair(catchId, codeCatch)).first->second.GetCodes();
+#else
+        codeBuffer.resize(size);
+        MakeSection(tableId, tsId, codeBuffer.data(), size, secIndex);
+        return codeBuffer.data();
+#endif
+    }
+
+    virtual size_t MakeCodes(TableId tableId, TsId tsId, 
+                     uchar_t *buffer, size_t bufferSize,
+                     SectionNumber secIndex) const
+    {
+        size_t size = GetCodesSize(tableId, tsId, secIndex);
+        if (size == 0)
+            return 0;        
+        assert(size <= bufferSize);
+
+#ifdef UseCatchOptimization
+        memcpy(buffer, GetCodes(tableId, tsId, secIndex), size);
+        return size;
+#else
+        return MakeSection(tableId, tsId, buffer, bufferSize, secIndex);
+#endif
+    }
+
+    virtual uint64_t GetFingerprint() const
+    {
+        return fingerprint;
+    }
+
+    virtual uint64_t GetContentFingerprint() const
+    {
+        return contentFingerprint;
+    }
+
+    virtual void SetChangeNumber(uint64_t *changeNumber)
+    {
+        this->changeNumber = changeNumber;
+    }
+
+protected:
+    /* fold the parameters of every AddXxx() call into the fingerprint. */
+    void UpdateFingerprint(const void *data, size_t size)
+    {
+        fingerprint = XxHash::CalculateHash((const uchar_t*)data, size, fingerprint);
+        contentFingerprint = XxHash::CalculateHash((const uchar_t*)data, size, contentFingerprint);
+    }
+
+    /* version_number is folded into the fingerprint, but not into the content fingerprint. */
+    void UpdateVersionFingerprint(const void *data, size_t size)
+    {
+        fingerprint = XxHash::CalculateHash((const uchar_t*)data, size, fingerprint);
+    }
+
+    /* hash of everything the codes of a section are made from. */
+    uint64_t GetSourceKey(CatchId catchId) const
+    {
+        uint64_t hash = XxHash::CalculateHash((const uchar_t*)&fingerprint, sizeof(fingerprint));
+        Version version = GetVersion();
+        hash = XxHash::CalculateHash((const uchar_t*)&version, sizeof(version), hash);
+        hash = XxHash::CalculateHash((const uchar_t*)&catchId, sizeof(catchId), hash);
+        /* 0 means no source key. */
+        return (hash == 0 ? 1 : hash);
+    }
+
+    /* make the codes of a section without the catch. */
+    size_t MakeSection(TableId tableId, TsId tsId, 
+                       uchar_t *buffer, size_t bufferSize,
+                       SectionNumber secIndex) const
+    {
+        const Layout &layout = GetLayout(tableId, tsId);
+        SectionNumber secNumber = (SectionNumber)layout.sizes.size();
+        //check secIndex is valid.
+        assert(secIndex < secNumber);
+        size_t size = layout.sizes[secIndex];
+        assert(size <= bufferSize && size != 0);
+
+        //all descriptors are packed in first section.
+        size_t var1Size = (secIndex == 0 ? GetTable().GetVar1().GetCodesSize() : 0);
+        size_t maxSize = Table::VarSize - var1Size;
+        Var2 var2 = GetTable().GetVar2(tableId);
+
+        uchar_t *ptr = buffer;
+        WriteHelper<uint16_t> writeHelper(ptr + sizeof(TableId), ptr + sizeof(TableId) + sizeof(TableSize));
+        ptr = ptr + GetTable().MakeCodes1(tableId, ptr, buffer + bufferSize - ptr, var1Size, 
+                                          secIndex, secNumber - 1);        
+        ptr = ptr + GetTable().MakeCodes2(var2, ptr, buffer + bufferSize - ptr, maxSize, 
+                                          layout.offsets[secIndex]); 
+        writeHelper.Write((SectionSyntaxIndicator << 15) | (Reserved1Bit << 14) | (Reserved2Bit << 12), ptr + 4); 
+        ptr = ptr + Write32(ptr, Crc32::CalculateCrc(buffer, ptr - buffer));
+
+        assert(size == ptr - buffer);
+        return ptr - buffer;
+    }
+
+    /* the sections of the table are changed without ClearCatch(). */
+    void IncreaseChangeNumber() const
+    {
+        if (changeNumber != nullptr)
+        {
+            ++*changeNumber;
+        }
+    }
+
+    void InitCatch()
+    {
+        ClearCatch();
+    }
+
+    void ClearCatch()
+    {
+        IncreaseChangeNumber();
+        layoutCatches.clear();
+#ifdef UseCatchOptimization
+        codeCatches.clear();
+#endif
+    }
+
+protected:
+    /* descriptors, services and transport streams of the table are allocated from
+       the arena, and are released all together when the table is deleted.
+     */
+    Arena arena;
+
+private:
+    /* var2 offset and codes size of every section of {tableId, tsId}. */
+    struct Layout
+    {
+        std::vector<size_t> offsets;
+        std::vector<size_t> sizes;
+    };
+
+    const Table & GetTable() const
+    {
+        return static_cast<const Table&>(*this);
+    }
+
+    /* the layout is kept with or without UseCatchOptimization, it is small, and without
+       it GetCodesSize() of every section would lay out all sections again.
+     */
+    const Layout & GetLayout(TableId tableId, TsId tsId) const
+    {
+        CatchId catchId = CatchIdHelper::GetCatchId(tableId, tsId);
+        typename map<CatchId, Layout>::iterator catchIter = layoutCatches.find(catchId);
+        if (catchIter != layoutCatches.end())
+        {
+            return catchIter->second;
+        }
+        Layout &layout = layoutCatches[catchId];
+
+        //all descriptors are packed in first section, the first section exists even if
+        //it is empty.
+        size_t var1Size = GetTable().GetVar1().GetCodesSize();
+        assert(var1Size <= (size_t)Table::VarSize);
+        Var2 var2 = GetTable().GetVar2(tableId);
+        size_t offset = 0;
+        size_t var2Size = var2.GetCodesSize(Table::VarSize - var1Size, offset);
+        do
+        {
+            layout.offsets.push_back(offset);
+            layout.sizes.push_back(Table::FixedSize + var1Size + var2Size);
+            offset = offset + var2Size;
+            var1Size = 0;
+        } while ((var2Size = var2.GetCodesSize(Table::VarSize, offset)) != 0);
+
+        return layout;
+    }
+
+private:
+    uint64_t fingerprint;
+    uint64_t contentFingerprint;
+    uint64_t *changeNumber;     //see SiTableInterface::SetChangeNumber().
+
+    mutable std::map<CatchId, Layout> layoutCatches;
+#ifdef UseCatchOptimization
+    mutable std::map<CatchId, SectionRef> codeCatches;    //sections shared in SectionStore.
+#else
+    mutable std::vector<uchar_t> codeBuffer;   //codes of last GetCodes().
+#endif
+};
+
 #endif
\ No newline at end of file
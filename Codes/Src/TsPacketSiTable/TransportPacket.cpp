@@ -1,271 +1,595 @@
-#include "Include/Foundation/SystemInclude.h"
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/PacketHelper.h"
-#include "Include/Foundation/Converter.h"
-#include "Include/Foundation/Crc32.h"
-#include "Include/Foundation/Deleter.h"
-
-/* TsPacketSiTable */
-#include "Include/TsPacketSiTable/SiTableInterface.h"
-#include "Include/TsPacketSiTable/TransportPacketInterface.h"
-#include "TransportPacket.h"
-using namespace std;
-
-TransportPacketInterface * TransportPacketInterface::CreateInstance(NetId netId, Pid pid)
-{
-    if (pid != NitPid && pid != BatPid && pid != SdtPid && pid != EitPid)
-        return nullptr;
-
-    return new TransportPacket(netId, pid);
-}
-
-TransportPacketsInterface * TransportPacketsInterface::CreateInstance()
-{
-    return new TransportPackets;
-}
-
-/**********************class TransportPacket**********************/
-TransportPacket::TransportPacket(NetId netId, Pid pid)
-    : adaptationFieldControl(1), pid(pid), netId(netId),
-      transportPriority(0)
-{}
-
-TransportPacket::~TransportPacket()
-{
-    for_each(siTables.begin(), siTables.end(), ScalarDeleter());
-}
-
-void TransportPacket::AddSiTable(SiTableInterface *siTable)
-{
-    TableId tableId = siTable->GetTableId();
-    switch (pid)
-    {
-    case BatPid:
-        assert(tableId == BatTableId 
-               || tableId == SdtActualTableId
-               || tableId == SdtOtherTableId);
-        break;
-
-    case EitPid:
-        assert(tableId == EitActualPfTableId 
-               || tableId == EitOtherPfTableId
-               || tableId == EitActualSchTableId
-               || tableId == EitOtherSchTableId);
-        break;
-        
-    case NitPid:
-        assert(tableId == NitActualTableId 
-               || tableId == NitOtherTableId);
-        break;
-    };
-    siTables.push_back(siTable);
-}
-
-void TransportPacket::DelSiTable(TableId tableId, SiTableKey key)
-{
-    list<SiTableInterface *>::iterator iter;
-    iter = find_if(siTables.begin(), siTables.end(), CompareSiTableIdAndKey(tableId, key));
-    if (iter != siTables.end())
-    {        
-        delete *iter;
-        siTables.erase(iter);
-    }
-}
-
-SiTableInterface * TransportPacket::FindSiTable(TableId tableId, SiTableKey key)
-{
-    list<SiTableInterface *>::iterator iter;
-    iter = find_if(siTables.begin(), siTables.end(), CompareSiTableIdAndKey(tableId, key));
-    return iter == siTables.end()? nullptr: *iter;
-}
-
-size_t TransportPacket::GetCodesSize(TableId tableId, TsId tsId) const
-{
-    uint_t packetNumber = 0; 
-
-    for (auto iter: siTables)
-    {
-        uint_t secNumber = iter->GetSecNumber(tableId, tsId);
-        for (uint_t i = 0; i < secNumber; ++i)
-        {            
-            size_t tableSize = iter->GetCodesSize(tableId, tsId, i);
-            assert(tableSize != 0);
-
-            //+1 for pointer_field
-            packetNumber = packetNumber + GetPacketNumber(tableSize + 1); 
-        }        
-    }
-
-    return (TsPacketSize * packetNumber);
-}
-
-NetId TransportPacket::GetNetId() const
-{
-    return netId;
-}
-
-Pid TransportPacket::GetPid() const
-{
-    return pid;
-}
-
-uint_t TransportPacket::GetPacketNumber(size_t codesSize) const
-{
-    assert(codesSize != 0);
-    return (codesSize + MaxTsPacketPayloadSize - 1) / MaxTsPacketPayloadSize;
-}
-
-size_t TransportPacket::MakeCodes(CcId ccId, TableId tableId, TsId tsId, 
-                                  uchar_t *buffer, size_t bufferSize)
-{
-    uchar_t *ptr = buffer;
-    assert(GetCodesSize(tableId, tsId) <= bufferSize);
-
-    map<uint_t, uchar_t>::iterator ccIter = continuityCounters.find(ccId);
-    if (ccIter == continuityCounters.end())
-    {
-        pair<map<uint_t, uchar_t>::iterator, bool> pr;
-        pr = continuityCounters.insert(make_pair(ccId, 0));
-        assert(pr.second == true);
-        ccIter = pr.first;
-    }
-
-    for (auto iter: siTables)
-    {
-        SectionNumber secNumber = (SectionNumber)iter->GetSecNumber(tableId, tsId);
-        for (SectionNumber i = 0; i < secNumber; ++i)
-        { 
-            size_t tablePlainSize = iter->GetCodesSize(tableId, tsId, i);
-            assert(tablePlainSize != 0);
-
-            //+1 for pointer_field
-            uint_t packetNumber = GetPacketNumber(tablePlainSize + 1); 
-            //pointer_field and 0xff tail included
-            size_t tableExtSize = MaxTsPacketPayloadSize * packetNumber;  
-
-            shared_ptr<uchar_t> tableCodes(new uchar_t[tableExtSize], ArrayDeleter());
-            Write8(tableCodes.get(), 0x0); //pointer_field
-            iter->MakeCodes(tableId, tsId, tableCodes.get() + 1, tablePlainSize, i);
-            memset(tableCodes.get() + 1 + tablePlainSize, 0xff, tableExtSize - 1 - tablePlainSize);
-
-            for (uint_t i = 0; i < packetNumber; ++i)
-            {
-                ptr = ptr + Write8(ptr, 0x47);
-                /* transport_error_indicator(1 bit), payload_unit_start_indicator(1 bit), 
-                    transport_priority(1 bit), PID(13 bits)
-                    transport_error_indicator = 0;
-                    transport_priority = 0;
-                    payload_unit_start_indicator = (first byte of current section) ? 1 : 0;
-                */
-                uint16_t startIndicator = (i == 0 ? 1 : 0);
-                ptr = ptr + Write16(ptr, (startIndicator << 14) | (transportPriority << 13) | pid);
-                /* transport_scrambling_control[2] = '00';
-		            adaptation_field_control[2] = '01';
-		            continuity_counter[4] = 'xxxx';
-		        */
-                /* refer to "2.4.3.3 Semantic definition of fields in Transport Stream packet layer",
-                    continuity_counter should be increase by 1 in all case.  
-                    when send udp packet, we may send duplicate packet two time, in this circumstance, the
-                    continuity_counter keep same with the oringinal packet.
-                    for example, the udp sending function may like this:
-                    ts.MakeCodes(buffer, bufferSize);
-                    for (ptr = buffer; ptr = ptr < buffer + buffersize; buffer + 188)
-                    {
-                        SendUdp(ptr, 188);
-                        SendUdp(ptr, 188);   //again
-                    }
-                */
-                /* The continuity_counter is a 4-bit field incrementing with each 
-                   Transport Stream packet with the same PID.
-                 */
-                ptr = ptr + Write8(ptr, (adaptationFieldControl << 4) | (ccIter->second++ & 0xF)); 
-                ptr = ptr + Write(ptr, MaxTsPacketPayloadSize, 
-                                  tableCodes.get() + MaxTsPacketPayloadSize * i, MaxTsPacketPayloadSize);
-            } //for (uint_t i = 0; i < packetNumber; ++i)
-        } //for (uint_t i = 0; i < secNumber; ++i)
-    } //for (auto iter: siTables)
-        
-    return ptr - buffer;
-}
-
-void TransportPacket::MapPid(uchar_t *buffer, size_t bufferSize, Pid from, Pid to) const
-{
-    assert(bufferSize % TsPacketSize == 0);
-
-    Pid pid;
-    if (bufferSize != 0)
-    {
-        ReadBuffer(buffer + 1, pid);
-        pid = pid & MaxPid;
-        if (pid != from)
-            return;
-    }
-
-    for (uchar_t *ptr = buffer; ptr < buffer + bufferSize; ptr = ptr + TsPacketSize)
-    {
-        ReadBuffer(ptr + 1, pid);
-        pid = (pid & ~MaxPid) | to;        
-        WriteBuffer(ptr + 1, pid);
-    }
-}
-
-void TransportPacket::RefreshCatch()
-{
-    list<SiTableInterface *>::iterator iter;
-    for (iter = siTables.begin(); iter != siTables.end(); ++iter)
-    {
-        (*iter)->RefreshCatch();
-    }
-}
-
-/**********************class TransportPackets**********************/
-TransportPackets::TransportPackets()
-{
-    AllocProxy();
-}
-
-TransportPackets::~TransportPackets()
-{
-    FreeProxy();
-    for_each(tsPackets.begin(), tsPackets.end(), ScalarDeleter());
-}
-
-void TransportPackets::Add(TransportPacketInterface *tsPacket)
-{
-    tsPackets.push_back(tsPacket);
-}
-
-TransportPackets::iterator TransportPackets::Begin()
-{
-    return iterator(this, NodePtr(tsPackets.begin()));
-}
-
-void TransportPackets::Delete(NetId netId, Pid pid)
-{
-    list<TransportPacketInterface *>::iterator iter;
-    iter = find_if(tsPackets.begin(), tsPackets.end(), CompareTsPacketNetIdAndPid(netId, pid));
-    if (iter != tsPackets.end())
-    {
-        tsPackets.erase(iter);
-        delete *iter;
-    }
-}
-
-TransportPackets::iterator TransportPackets::End()
-{
-    return iterator(this, NodePtr(tsPackets.end()));
-}
-
-TransportPackets::iterator TransportPackets::Find(NetId netId, Pid pid)
-{
-    list<TransportPacketInterface *>::iterator iter;
-    iter = find_if(tsPackets.begin(), tsPackets.end(), CompareTsPacketNetIdAndPid(netId, pid));
-    return iterator(this, iter);
-}
-
-TransportPackets::NodePtr TransportPackets::GetMyHead()
-{
-    return NodePtr(tsPackets.end());
-}
+#include "Include/Foundation/SystemInclude.h"
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/PacketHelper.h"
+#include "Include/Foundation/Converter.h"
+#include "Include/Foundation/Crc32.h"
+#include "Include/Foundation/Deleter.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+#include "Include/TsPacketSiTable/TransportPacketInterface.h"
+#include "TransportPacket.h"
+using namespace std;
+
+/* ts id of the tables (nit, bat) which are sent for every ts, out of the range of TsId. */
+#define AnyTsId 0x10000
+
+TransportPacketInterface * TransportPacketInterface::CreateInstance(NetId netId, Pid pid)
+{
+    if (pid != NitPid && pid != BatPid && pid != SdtPid && pid != EitPid)
+        return nullptr;
+
+    return new TransportPacket(netId, pid);
+}
+
+TransportPacketsInterface * TransportPacketsInterface::CreateInstance()
+{
+    return new TransportPackets;
+}
+
+/**********************class Packetizer**********************/
+Packetizer::Packetizer(uchar_t *buffer, size_t bufferSize, uint16_t pidField, uchar_t adaptationFieldControl,
+                       uchar_t &continuityCounter, const vector<size_t> &sizes, bool packing)
+    : buffer(buffer), bufferSize(bufferSize), pidField(pidField), adaptationFieldControl(adaptationFieldControl),
+      continuityCounter(continuityCounter), packetIndex(0), ptr(buffer), payloadEnd(buffer)
+{
+    Plan(sizes, packing, packets);
+    assert(packets.size() * TsPacketSize <= bufferSize);
+}
+
+Packetizer::~Packetizer()
+{
+}
+
+size_t Packetizer::GetPacketNumber(const vector<size_t> &sizes, bool packing)
+{
+    if (packing)
+    {
+        vector<Packet> packets;
+        Plan(sizes, packing, packets);
+        return packets.size();
+    }
+
+    size_t packetNumber = 0;
+    for (auto size: sizes)
+    {
+        //+1 for pointer_field
+        packetNumber = packetNumber + (size + 1 + MaxTsPacketPayloadSize - 1) / MaxTsPacketPayloadSize;
+    }
+    return packetNumber;
+}
+
+size_t Packetizer::Finish()
+{
+    assert(packetIndex == packets.size());
+    if (packetIndex != 0)
+    {
+        //0xff tail of the last section.
+        uchar_t *packetEnd = buffer + TsPacketSize * packetIndex;
+        memset(ptr, 0xff, packetEnd - ptr);
+        ptr = packetEnd;
+    }
+    return ptr - buffer;
+}
+
+void Packetizer::WriteSection(const uchar_t *codes, size_t size)
+{
+    Copy(codes, size);
+}
+
+/* private function */
+void Packetizer::Plan(const vector<size_t> &sizes, bool packing, vector<Packet> &packets)
+{
+    packets.clear();
+    if (!packing)
+    {
+        for (auto size: sizes)
+        {
+            for (size_t offset = 0; offset < size;)
+            {
+                Packet packet;
+                packet.unitStart = (offset == 0);
+                packet.pointerField = 0;
+                packet.size = std::min(MaxTsPacketPayloadSize - (packet.unitStart ? 1 : 0), size - offset);
+                packets.push_back(packet);
+                offset = offset + packet.size;
+            }
+        }
+        return;
+    }
+
+    vector<size_t> starts;
+    size_t totalSize = 0;
+    for (auto size: sizes)
+    {
+        starts.push_back(totalSize);
+        totalSize = totalSize + size;
+    }
+
+    size_t next = 0;    //index of the first section which starts at or after offset.
+    for (size_t offset = 0; offset < totalSize;)
+    {
+        while (next < starts.size() && starts[next] < offset)
+        {
+            ++next;
+        }
+
+        Packet packet;
+        if (next < starts.size() && starts[next] < offset + MaxTsPacketPayloadSize - 1)
+        {
+            /* a section starts in the packet, pointer_field points to it, the bytes before
+               it are the tail of previous section.
+             */
+            packet.unitStart = true;
+            packet.pointerField = (uchar_t)(starts[next] - offset);
+            packet.size = std::min(MaxTsPacketPayloadSize - 1, totalSize - offset);
+        }
+        else
+        {
+            /* a section can only start in a packet with payload_unit_start_indicator, if
+               the next section would start at the last byte, the byte is stuffed with 0xff.
+             */
+            packet.unitStart = false;
+            packet.pointerField = 0;
+            packet.size = std::min(MaxTsPacketPayloadSize, totalSize - offset);
+            if (next < starts.size() && starts[next] < offset + packet.size)
+            {
+                packet.size = starts[next] - offset;
+            }
+        }
+        packets.push_back(packet);
+        offset = offset + packet.size;
+    }
+}
+
+void Packetizer::Copy(const uchar_t *data, size_t size)
+{
+    while (size != 0)
+    {
+        if (ptr == payloadEnd)
+        {
+            NextPacket();
+        }
+
+        size_t copySize = std::min(size, (size_t)(payloadEnd - ptr));
+        memcpy(ptr, data, copySize);
+        ptr = ptr + copySize;
+        data = data + copySize;
+        size = size - copySize;
+    }
+}
+
+void Packetizer::NextPacket()
+{
+    assert(packetIndex < packets.size());
+    uchar_t *packetStart = buffer + TsPacketSize * packetIndex;
+    if (packetIndex != 0)
+    {
+        //0xff tail of previous section.
+        memset(ptr, 0xff, packetStart - ptr);
+    }
+
+    const Packet &packet = packets[packetIndex++];
+    ptr = packetStart;
+    ptr = ptr + Write8(ptr, 0x47);
+    /* transport_error_indicator(1 bit), payload_unit_start_indicator(1 bit), 
+        transport_priority(1 bit), PID(13 bits)
+        transport_error_indicator = 0;
+        transport_priority = 0;
+        payload_unit_start_indicator = (a section starts in current packet) ? 1 : 0;
+    */
+    uint16_t startIndicator = (packet.unitStart ? 1 : 0);
+    ptr = ptr + Write16(ptr, (startIndicator << 14) | pidField);
+    /* transport_scrambling_control[2] = '00';
+        adaptation_field_control[2] = '01';
+        continuity_counter[4] = 'xxxx';
+    */
+    /* refer to "2.4.3.3 Semantic definition of fields in Transport Stream packet layer",
+        continuity_counter should be increase by 1 in all case.  
+        when send udp packet, we may send duplicate packet two time, in this circumstance, the
+        continuity_counter keep same with the oringinal packet.
+        for example, the udp sending function may like this:
+        ts.MakeCodes(buffer, bufferSize);
+        for (ptr = buffer; ptr = ptr < buffer + buffersize; buffer + 188)
+        {
+            SendUdp(ptr, 188);
+            SendUdp(ptr, 188);   //again
+        }
+    */
+    /* The continuity_counter is a 4-bit field incrementing with each 
+       Transport Stream packet with the same PID.
+     */
+    ptr = ptr + Write8(ptr, (adaptationFieldControl << 4) | (continuityCounter++ & 0xF)); 
+    if (packet.unitStart)
+    {
+        ptr = ptr + Write8(ptr, packet.pointerField);
+    }
+    payloadEnd = ptr + packet.size;
+}
+
+/**********************class TransportPacket**********************/
+TransportPacket::TransportPacket(NetId netId, Pid pid)
+    : adaptationFieldControl(1), pid(pid), netId(netId),
+      transportPriority(0), sectionPacking(false), totalPacketNumber(0), savedPacketNumber(0)
+{}
+
+TransportPacket::~TransportPacket()
+{
+    for (auto &iter: siTables)
+    {
+        for_each(iter.second.begin(), iter.second.end(), ScalarDeleter());
+    }
+}
+
+void TransportPacket::AddSiTable(SiTableInterface *siTable)
+{
+    TableId tableId = siTable->GetTableId();
+    switch (pid)
+    {
+    case BatPid:
+        assert(tableId == BatTableId 
+               || tableId == SdtActualTableId
+               || tableId == SdtOtherTableId);
+        break;
+
+    case EitPid:
+        assert(tableId == EitActualPfTableId 
+               || tableId == EitOtherPfTableId
+               || tableId == EitActualSchTableId
+               || tableId == EitOtherSchTableId);
+        break;
+        
+    case NitPid:
+        assert(tableId == NitActualTableId 
+               || tableId == NitOtherTableId);
+        break;
+    };
+    siTables[GetIdAndKey(tableId, siTable->GetKey())].push_back(siTable);
+    uint32_t tsKey = GetTsKey(*siTable);
+    tsIndex[tsKey].push_back(siTable);
+    /* the node of an unordered_map doesn't move when the map grows. */
+    siTable->SetChangeNumber(&changeNumbers[tsKey]);
+    sizeCaches.clear();
+}
+
+void TransportPacket::DelSiTable(TableId tableId, SiTableKey key)
+{
+    /* the oldest table of {tableId, key} is deleted. */
+    unordered_map<SiTableIdAndKey, SiTables>::iterator iter = siTables.find(GetIdAndKey(tableId, key));
+    if (iter == siTables.end())
+    {
+        return;
+    }
+
+    SiTableInterface *siTable = iter->second.front();
+    iter->second.erase(iter->second.begin());
+    if (iter->second.empty())
+    {
+        siTables.erase(iter);
+    }
+
+    unordered_map<uint32_t, SiTables>::iterator tsIter = tsIndex.find(GetTsKey(*siTable));
+    assert(tsIter != tsIndex.end());
+    tsIter->second.erase(find(tsIter->second.begin(), tsIter->second.end(), siTable));
+    siTable->SetChangeNumber(nullptr);
+    if (tsIter->second.empty())
+    {
+        changeNumbers.erase(tsIter->first);
+        tsIndex.erase(tsIter);
+    }
+    sizeCaches.clear();
+    delete siTable;
+}
+
+SiTableInterface * TransportPacket::FindSiTable(TableId tableId, SiTableKey key)
+{
+    unordered_map<SiTableIdAndKey, SiTables>::iterator iter = siTables.find(GetIdAndKey(tableId, key));
+    return iter == siTables.end()? nullptr: iter->second.front();
+}
+
+size_t TransportPacket::GetCodesSize(TableId tableId, TsId tsId) const
+{
+    return GetSizeCache(tableId, tsId).codesSize;
+}
+
+NetId TransportPacket::GetNetId() const
+{
+    return netId;
+}
+
+time_t TransportPacket::GetNextBoundary() const
+{
+    time_t boundary = 0;
+    for (auto &iter: siTables)
+    {
+        for (auto siTable: iter.second)
+        {
+            time_t tableBoundary = siTable->GetNextBoundary();
+            if (tableBoundary != 0 && (boundary == 0 || tableBoundary < boundary))
+            {
+                boundary = tableBoundary;
+            }
+        }
+    }
+    return boundary;
+}
+
+uint64_t TransportPacket::GetPacketNumber() const
+{
+    return totalPacketNumber;
+}
+
+Pid TransportPacket::GetPid() const
+{
+    return pid;
+}
+
+uint64_t TransportPacket::GetSavedPacketNumber() const
+{
+    return savedPacketNumber;
+}
+
+size_t TransportPacket::MakeCodes(CcId ccId, TableId tableId, TsId tsId, 
+                                  uchar_t *buffer, size_t bufferSize)
+{
+    map<uint_t, uchar_t>::iterator ccIter = continuityCounters.find(ccId);
+    if (ccIter == continuityCounters.end())
+    {
+        pair<map<uint_t, uchar_t>::iterator, bool> pr;
+        pr = continuityCounters.insert(make_pair(ccId, 0));
+        assert(pr.second == true);
+        ccIter = pr.first;
+    }
+
+    const SizeCache &cache = GetSizeCache(tableId, tsId);
+    const Sections &sections = cache.sections;
+    const vector<size_t> &sizes = cache.sizes;
+
+    /* the sections are copied from the catch of the tables into the ts packets directly. */
+    Packetizer packetizer(buffer, bufferSize, (uint16_t)((transportPriority << 13) | pid), adaptationFieldControl,
+                          ccIter->second, sizes, sectionPacking);
+    for (size_t i = 0; i < sections.size(); ++i)
+    {
+        packetizer.WriteSection(sections[i].first->GetCodes(tableId, tsId, sections[i].second), sizes[i]);
+    }
+    size_t size = packetizer.Finish();
+
+    uint64_t packetNumber = size / TsPacketSize;
+    totalPacketNumber = totalPacketNumber + packetNumber;
+    if (sectionPacking)
+    {
+        savedPacketNumber = savedPacketNumber + (Packetizer::GetPacketNumber(sizes, false) - packetNumber);
+    }
+    return size;
+}
+
+void TransportPacket::MapPid(uchar_t *buffer, size_t bufferSize, Pid from, Pid to) const
+{
+    assert(bufferSize % TsPacketSize == 0);
+
+    Pid pid;
+    if (bufferSize != 0)
+    {
+        ReadBuffer(buffer + 1, pid);
+        pid = pid & MaxPid;
+        if (pid != from)
+            return;
+    }
+
+    for (uchar_t *ptr = buffer; ptr < buffer + bufferSize; ptr = ptr + TsPacketSize)
+    {
+        ReadBuffer(ptr + 1, pid);
+        pid = (pid & ~MaxPid) | to;        
+        WriteBuffer(ptr + 1, pid);
+    }
+}
+
+void TransportPacket::NextRound(TableId tableId)
+{
+    /* rounds[tableId].first is the number of started rounds, current round is first - 1. */
+    pair<uint64_t, time_t> &round = rounds[tableId];
+    ++round.first;
+    round.second = time(nullptr);
+
+    /* the due sections are changed by the round. */
+    if (!tiers.empty())
+    {
+        sizeCaches.clear();
+    }
+}
+
+void TransportPacket::RefreshCatch()
+{
+    for (auto &iter: siTables)
+    {
+        for (auto siTable: iter.second)
+        {
+            siTable->RefreshCatch();
+        }
+    }
+}
+
+void TransportPacket::SetSectionPacking(bool enabled)
+{
+    sectionPacking = enabled;
+    sizeCaches.clear();
+}
+
+void TransportPacket::SetSectionTiers(const SectionTiers &tiers)
+{
+    this->tiers = tiers;
+    sizeCaches.clear();
+}
+
+/* private function */
+SiTableIdAndKey TransportPacket::GetIdAndKey(TableId tableId, SiTableKey key)
+{
+    return ((SiTableIdAndKey)tableId << 32) | key;
+}
+
+void TransportPacket::GetSections(TableId tableId, TsId tsId, Sections &sections, vector<size_t> &sizes) const
+{
+    TableId indexTableId = GetIndexTableId(tableId);
+    uint32_t tsKeys[] = {GetTsKey(indexTableId, tsId), GetTsKey(indexTableId, AnyTsId)};
+    for (size_t k = 0; k < sizeof(tsKeys) / sizeof(tsKeys[0]); ++k)
+    {
+        unordered_map<uint32_t, SiTables>::const_iterator tsIter = tsIndex.find(tsKeys[k]);
+        if (tsIter == tsIndex.end())
+        {
+            continue;
+        }
+
+        for (auto iter: tsIter->second)
+        {
+            SectionNumber secNumber = (SectionNumber)iter->GetSecNumber(tableId, tsId);
+            for (SectionNumber i = 0; i < secNumber; ++i)
+            { 
+                if (!IsSectionDue(iter, tableId, tsId, i))
+                {
+                    continue;
+                }
+
+                size_t size = iter->GetCodesSize(tableId, tsId, i);
+                assert(size != 0);
+                sections.push_back(make_pair(iter, i));
+                sizes.push_back(size);
+            }
+        }
+    }
+}
+
+const TransportPacket::SizeCache & TransportPacket::GetSizeCache(TableId tableId, TsId tsId) const
+{
+    SizeCache &cache = sizeCaches[GetTsKey(tableId, tsId)];
+    uint64_t changeNumber = GetChangeNumber(tableId, tsId);
+    if (!cache.valid || cache.changeNumber != changeNumber)
+    {
+        cache.sections.clear();
+        cache.sizes.clear();
+        GetSections(tableId, tsId, cache.sections, cache.sizes);
+        cache.codesSize = TsPacketSize * Packetizer::GetPacketNumber(cache.sizes, sectionPacking);
+        cache.changeNumber = changeNumber;
+        cache.valid = true;
+    }
+    return cache;
+}
+
+uint64_t TransportPacket::GetChangeNumber(TableId tableId, TsId tsId) const
+{
+    uint64_t changeNumber = 0;
+    TableId indexTableId = GetIndexTableId(tableId);
+    uint32_t tsKeys[] = {GetTsKey(indexTableId, tsId), GetTsKey(indexTableId, AnyTsId)};
+    for (size_t k = 0; k < sizeof(tsKeys) / sizeof(tsKeys[0]); ++k)
+    {
+        unordered_map<uint32_t, uint64_t>::const_iterator iter = changeNumbers.find(tsKeys[k]);
+        if (iter != changeNumbers.end())
+        {
+            changeNumber = changeNumber + iter->second;
+        }
+    }
+    return changeNumber;
+}
+
+TableId TransportPacket::GetIndexTableId(TableId tableId)
+{
+    if (tableId == EitActualPfTableId)
+    {
+        return EitActualSchTableId;
+    }
+    if (tableId == EitOtherPfTableId)
+    {
+        return EitOtherSchTableId;
+    }
+    return tableId;
+}
+
+uint32_t TransportPacket::GetTsKey(TableId tableId, uint32_t tsId)
+{
+    return ((uint32_t)tableId << 17) | tsId;
+}
+
+uint32_t TransportPacket::GetTsKey(const SiTableInterface &siTable)
+{
+    TsId tsId;
+    return GetTsKey(siTable.GetTableId(), siTable.GetTsId(tsId) ? tsId : AnyTsId);
+}
+
+bool TransportPacket::IsSectionDue(const SiTableInterface *siTable, TableId tableId, TsId tsId, 
+                                   SectionNumber secIndex) const
+{
+    if (tiers.empty() || (tableId != EitActualSchTableId && tableId != EitOtherSchTableId))
+    {
+        return true;
+    }
+
+    map<TableId, pair<uint64_t, time_t>>::const_iterator roundIter = rounds.find(tableId);
+    if (roundIter == rounds.end())
+    {
+        /* NextRound() was not called, all sections are due. */
+        return true;
+    }
+
+    uint64_t round = roundIter->second.first - 1;
+    time_t distance = siTable->GetSectionTime(tableId, tsId, secIndex) - roundIter->second.second;
+    SectionTiers::const_iterator iter;
+    for (iter = tiers.begin(); iter != tiers.end(); ++iter)
+    {
+        if (iter->first == 0 || distance < iter->first)
+        {
+            return (round % std::max(iter->second, (uint_t)1)) == 0;
+        }
+    }
+    return true;
+}
+
+/**********************class TransportPackets**********************/
+TransportPackets::TransportPackets()
+{
+    AllocProxy();
+}
+
+TransportPackets::~TransportPackets()
+{
+    FreeProxy();
+    for_each(tsPackets.begin(), tsPackets.end(), ScalarDeleter());
+}
+
+void TransportPackets::Add(TransportPacketInterface *tsPacket)
+{
+    tsPackets.push_back(tsPacket);
+}
+
+TransportPackets::iterator TransportPackets::Begin()
+{
+    return iterator(this, NodePtr(tsPackets.begin()));
+}
+
+void TransportPackets::Delete(NetId netId, Pid pid)
+{
+    list<TransportPacketInterface *>::iterator iter;
+    iter = find_if(tsPackets.begin(), tsPackets.end(), CompareTsPacketNetIdAndPid(netId, pid));
+    if (iter != tsPackets.end())
+    {
+        tsPackets.erase(iter);
+        delete *iter;
+    }
+}
+
+TransportPackets::iterator TransportPackets::End()
+{
+    return iterator(this, NodePtr(tsPackets.end()));
+}
+
+TransportPackets::iterator TransportPackets::Find(NetId netId, Pid pid)
+{
+    list<TransportPacketInterface *>::iterator iter;
+    iter = find_if(tsPackets.begin(), tsPackets.end(), CompareTsPacketNetIdAndPid(netId, pid));
+    return iterator(this, iter);
+}
+
+TransportPackets::NodePtr TransportPackets::GetMyHead()
+{
+    return NodePtr(tsPackets.end());
+}
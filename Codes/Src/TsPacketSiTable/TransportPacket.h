@@ -1,88 +1,196 @@
-#ifndef _TsPacket_h_
-#define _TsPacket_h_
-
-#pragma pack(push, 1)
-/*
-    define struct transport_packet just for calculating fixed fields size.
-*/
-struct transport_packet
-{
-    uchar_t  sync_byte:8;                       // 8 uimsbf  -
-    uint16_t transport_error_indicator:1;       // 1 bslbf    
-    uint16_t payload_unit_start_indicator:1;    // 1 bslbf    
-    uint16_t transport_priority:1;              // 1 bslbf
-    uint16_t PID:13;                            // 13 bslbf  --
-    uchar_t  transport_scrambling_control:2;    // 2 bslbf
-    uchar_t  adaptation_field_control:2;        // 2 bslbf
-    uchar_t  continuity_counter:4;              // 4 bslbf   -
-    //if(adaptation_field_control == '10' || adaptation_field_control == '11')
-    //{
-    //    adaptation_field()
-    //}
-    //if(adaptation_field_control == '01' || adaptation_field_control == '11') 
-    //{
-    //    for (i = 0; i < N; i++)
-    //    {
-    //        data_byte 8 bslbf  //could be 2.4.3.6 PES packet
-    //    }
-    //}
-};
-#pragma pack(pop)
-#define MaxTsPacketPayloadSize (TsPacketSize - sizeof(transport_packet))
-
-/**********************class TransportPacket**********************/
-class TransportPacket: public TransportPacketInterface
-{
-public:
-    TransportPacket(NetId netId, Pid pid);
-    virtual ~TransportPacket();
-
-    void AddSiTable(SiTableInterface *siTable);
-    void DelSiTable(TableId tableId, SiTableKey key);
-
-    SiTableInterface * FindSiTable(TableId tableId, SiTableKey key);
-    size_t GetCodesSize(TableId tableId, TsId tsId) const;
-    NetId  GetNetId() const;
-    Pid    GetPid() const;
-    size_t MakeCodes(CcId ccId, TableId tableId, TsId tsId, 
-                     uchar_t *buffer, size_t bufferSize);
-    void MapPid(uchar_t *buffer, size_t bufferSize, Pid from, Pid to) const;
-    void RefreshCatch();
-
-private:
-    uint_t GetPacketNumber(size_t codesSize) const;
-
-private:
-    std::list<SiTableInterface *> siTables;
-
-    uchar_t  adaptationFieldControl;
-    /* the same TransportPacket will be sent to multipule socket-addr, so 
-     * we need save one continuity_counter per socket-addr.
-     * map<continuity-counter-id, continuity-counter>
-    */
-    std::map<CcId, uchar_t> continuityCounters;
-
-    NetId    netId;
-    Pid      pid;
-    uint16_t transportPriority;
-};
-
-/**********************class TransportPackets**********************/
-class TransportPackets: public TransportPacketsInterface
-{
-public:
-    TransportPackets();
-    virtual ~TransportPackets();
-
-    void Add(TransportPacketInterface *tsPacket);
-    iterator Begin();
-    void Delete(NetId netId, Pid pid);
-    iterator End();
-    iterator Find(NetId netId, Pid pid);
-    NodePtr GetMyHead();
-
-private:
-    std::list<TransportPacketInterface*> tsPackets;
-};
-
+#ifndef _TsPacket_h_
+#define _TsPacket_h_
+
+#pragma pack(push, 1)
+/*
+    define struct transport_packet just for calculating fixed fields size.
+*/
+struct transport_packet
+{
+    uchar_t  sync_byte:8;                       // 8 uimsbf  -
+    uint16_t transport_error_indicator:1;       // 1 bslbf    
+    uint16_t payload_unit_start_indicator:1;    // 1 bslbf    
+    uint16_t transport_priority:1;              // 1 bslbf
+    uint16_t PID:13;                            // 13 bslbf  --
+    uchar_t  transport_scrambling_control:2;    // 2 bslbf
+    uchar_t  adaptation_field_control:2;        // 2 bslbf
+    uchar_t  continuity_counter:4;              // 4 bslbf   -
+    //if(adaptation_field_control == '10' || adaptation_field_control == '11')
+    //{
+    //    adaptation_field()
+    //}
+    //if(adaptation_field_control == '01' || adaptation_field_control == '11') 
+    //{
+    //    for (i = 0; i < N; i++)
+    //    {
+    //        data_byte 8 bslbf  //could be 2.4.3.6 PES packet
+    //    }
+    //}
+};
+#pragma pack(pop)
+#define MaxTsPacketPayloadSize (TsPacketSize - sizeof(transport_packet))
+
+/**********************class Packetizer**********************/
+/* cursor over the ts packets of the output buffer, sections are written straight into
+   the payload of the packets, the packet header, pointer_field and 0xff stuffing are
+   inserted at the packet boundaries.  the packets of all sections are planned by the
+   constructor, because the pointer_field of a packet is written before the section
+   which starts in the packet.
+   packing false: every section starts in a new ts packet.
+   packing true:  a section starts in the ts packet where the previous section ends.
+   Example:
+    Packetizer packetizer(buffer, bufferSize, pidField, 1, continuityCounter, sizes, false);
+    packetizer.WriteSection(codes0, sizes[0]);  //a whole section, crc32 included.
+    packetizer.WriteSection(codes1, sizes[1]);
+    size_t size = packetizer.Finish();
+ */
+class Packetizer
+{
+public:
+    /* pidField: (transport_priority << 13) | PID */
+    Packetizer(uchar_t *buffer, size_t bufferSize, uint16_t pidField, uchar_t adaptationFieldControl,
+               uchar_t &continuityCounter, const std::vector<size_t> &sizes, bool packing);
+    ~Packetizer();
+
+    /* number of ts packets of the sections "sizes". */
+    static size_t GetPacketNumber(const std::vector<size_t> &sizes, bool packing);
+
+    /* stuff the last packet, return the size of all packets. */
+    size_t Finish();
+    /* write a whole section which has crc32 already. */
+    void WriteSection(const uchar_t *codes, size_t size);
+
+private:
+    struct Packet
+    {
+        size_t  size;           //section bytes in the packet.
+        bool    unitStart;      //payload_unit_start_indicator, pointer_field is present.
+        uchar_t pointerField;
+    };
+
+    static void Plan(const std::vector<size_t> &sizes, bool packing, std::vector<Packet> &packets);
+    void Copy(const uchar_t *data, size_t size);
+    void NextPacket();
+
+private:
+    uchar_t  *buffer;
+    size_t   bufferSize;
+    uint16_t pidField;
+    uchar_t  adaptationFieldControl;
+    uchar_t  &continuityCounter;
+    std::vector<Packet> packets;
+    size_t   packetIndex;   //index of next packet.
+    uchar_t  *ptr;          //write position.
+    uchar_t  *payloadEnd;   //end of section bytes of current packet.
+};
+
+/**********************class TransportPacket**********************/
+class TransportPacket: public TransportPacketInterface
+{
+public:
+    TransportPacket(NetId netId, Pid pid);
+    virtual ~TransportPacket();
+
+    void AddSiTable(SiTableInterface *siTable);
+    void DelSiTable(TableId tableId, SiTableKey key);
+
+    SiTableInterface * FindSiTable(TableId tableId, SiTableKey key);
+    size_t GetCodesSize(TableId tableId, TsId tsId) const;
+    NetId  GetNetId() const;
+    time_t GetNextBoundary() const;
+    uint64_t GetPacketNumber() const;
+    Pid    GetPid() const;
+    uint64_t GetSavedPacketNumber() const;
+    size_t MakeCodes(CcId ccId, TableId tableId, TsId tsId, 
+                     uchar_t *buffer, size_t bufferSize);
+    void MapPid(uchar_t *buffer, size_t bufferSize, Pid from, Pid to) const;
+    void NextRound(TableId tableId);
+    void RefreshCatch();
+    void SetSectionPacking(bool enabled);
+    void SetSectionTiers(const SectionTiers &tiers);
+
+private:
+    typedef std::vector<std::pair<const SiTableInterface*, SectionNumber>> Sections;
+    typedef std::vector<SiTableInterface*> SiTables;
+    /* due sections of {tableId, tsId} and their size in ts packets, shared by GetCodesSize()
+       and MakeCodes() of all receivers of the ts.  built again after a table is added or
+       deleted, or after a table of {tableId, tsId} is changed: the table increases the
+       change number of its tsIndex key (SiTableInterface::SetChangeNumber()).
+     */
+    struct SizeCache
+    {
+        SizeCache(): valid(false), changeNumber(0), codesSize(0)
+        {}
+
+        bool     valid;
+        uint64_t changeNumber;      //GetChangeNumber(tableId, tsId) when it was built.
+        Sections sections;
+        std::vector<size_t> sizes;
+        size_t   codesSize;
+    };
+
+    static SiTableIdAndKey GetIdAndKey(TableId tableId, SiTableKey key);
+    /* sum of change numbers of the tsIndex keys of {tableId, tsId}. */
+    uint64_t GetChangeNumber(TableId tableId, TsId tsId) const;
+    /* due sections of {tableId, tsId} in sending order, and their sizes. */
+    void GetSections(TableId tableId, TsId tsId, Sections &sections, std::vector<size_t> &sizes) const;
+    const SizeCache & GetSizeCache(TableId tableId, TsId tsId) const;
+    /* key of tsIndex, "tsId" is AnyTsId for the tables which are sent for every ts. */
+    /* eit p/f is sent by the eit table of schedule table id. */
+    static TableId GetIndexTableId(TableId tableId);
+    static uint32_t GetTsKey(TableId tableId, uint32_t tsId);
+    static uint32_t GetTsKey(const SiTableInterface &siTable);
+    bool IsSectionDue(const SiTableInterface *siTable, TableId tableId, TsId tsId, 
+                      SectionNumber secIndex) const;
+
+private:
+    /* all tables of {table id, key}, in adding order. there are 2 tables only when a new
+       table is added to replace the live one, until the old one is deleted.
+     */
+    std::unordered_map<SiTableIdAndKey, SiTables> siTables;
+    /* tables of {table id, ts id}, in adding order, so a send only asks the tables which 
+       may have sections of the ts.
+     */
+    std::unordered_map<uint32_t, SiTables> tsIndex;
+    /* change number of every tsIndex key, increased by the tables of the key. */
+    std::unordered_map<uint32_t, uint64_t> changeNumbers;
+    mutable std::unordered_map<uint32_t, SizeCache> sizeCaches; //GetTsKey(tableId, tsId) -> cache
+
+    uchar_t  adaptationFieldControl;
+    /* the same TransportPacket will be sent to multipule socket-addr, so 
+     * we need save one continuity_counter per socket-addr.
+     * map<continuity-counter-id, continuity-counter>
+    */
+    std::map<CcId, uchar_t> continuityCounters;
+
+    NetId    netId;
+    Pid      pid;
+    uint16_t transportPriority;
+
+    SectionTiers tiers;
+    bool     sectionPacking;
+    uint64_t totalPacketNumber;     //ts packets made by MakeCodes().
+    uint64_t savedPacketNumber;     //ts packets saved by section packing.
+    /* round number and start time of current round of every table id. */
+    std::map<TableId, std::pair<uint64_t, time_t>> rounds;
+};
+
+/**********************class TransportPackets**********************/
+class TransportPackets: public TransportPacketsInterface
+{
+public:
+    TransportPackets();
+    virtual ~TransportPackets();
+
+    void Add(TransportPacketInterface *tsPacket);
+    iterator Begin();
+    void Delete(NetId netId, Pid pid);
+    iterator End();
+    iterator Find(NetId netId, Pid pid);
+    NodePtr GetMyHead();
+
+private:
+    std::list<TransportPacketInterface*> tsPackets;
+};
+
 #endif
\ No newline at end of file
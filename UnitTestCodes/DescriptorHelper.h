@@ -1,10 +1,10 @@
-#ifndef _UtDescriptorHelper_h_
-#define _UtDescriptorHelper_h_
-
-CxxBeginNameSpace(UnitTest)
-
-std::string GetDescriptorString(size_t size);
-
-CxxEndNameSpace
-
+#ifndef _UtDescriptorHelper_h_
+#define _UtDescriptorHelper_h_
+
+CxxBeginNameSpace(UnitTest)
+
+std::string GetDescriptorString(size_t size);
+
+CxxEndNameSpace
+
 #endif
\ No newline at end of file
@@ -1,3 +1,3 @@
-#ifdef _WIN32
-#   pragma comment(lib, "cppunit.lib")
+#ifdef _WIN32
+#   pragma comment(lib, "cppunit.lib")
 #endif
\ No newline at end of file
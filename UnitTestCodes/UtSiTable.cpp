@@ -1,1482 +1,2268 @@
-#include "Include/Foundation/SystemInclude.h"
-#include <cppunit/extensions/HelperMacros.h>
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/Debug.h"
-
-/* TsPacketSiTable */
-#include "Include/TsPacketSiTable/SiTableInterface.h"
-
-#include "DescriptorHelper.h"
-#include "UtSiTable.h"
-using namespace std;
-
-CxxBeginNameSpace(UnitTest)
-    
-/**********************class SiTable**********************/
-CPPUNIT_TEST_SUITE_REGISTRATION(SiTable);
-
-void SiTable::TestBatConstruct()
-{    
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateBatInstance(InvalidSiTableTableId, bouquetId, version);
-	CPPUNIT_ASSERT(siTable == nullptr);
-
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
-    CPPUNIT_ASSERT(siTable != nullptr);
-    delete siTable;
-}
-
-void SiTable::TestBatGetCodesSize()
-{
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
-    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 0) == sizeof(bouquet_association_section));
-
-    uint_t desSize = 100;
-    uint_t desNumber = (MaxBatDesAndTsContentSize - 2) / desSize;
-    for (uint_t i = 0; i < desNumber; ++i)
-    {
-        siTable->AddDescriptor(GetDescriptorString(desSize));
-    }
-    siTable->AddDescriptor(GetDescriptorString(MaxBatDesAndTsContentSize - desSize * desNumber));
-    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 0) == MaxBatSectionLength);
-
-    siTable->AddTs(tsId, onId);
-    size_t size = sizeof(bouquet_association_section) + sizeof(transport_stream);
-    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 0) == MaxBatSectionLength);
-    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 1) == size);
-}
-
-void SiTable::TestBatGetKey()
-{
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
-    CPPUNIT_ASSERT(siTable->GetKey() == bouquetId);
-}
-
-void SiTable::TestBatGetSecNumber()
-{
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
-    CPPUNIT_ASSERT(siTable->GetSecNumber(InvalidSiTableTableId, tsId) == 0);
-    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) == 1);
-
-    uint_t desSize = 100;
-    uint_t desNumber = (MaxBatDesAndTsContentSize - 2) / desSize;
-    for (uint_t i = 0; i < desNumber; ++i)
-    {
-        siTable->AddDescriptor(GetDescriptorString(desSize));
-    }
-    siTable->AddDescriptor(GetDescriptorString(MaxBatDesAndTsContentSize - desSize * desNumber));
-    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) == 1);
-
-    siTable->AddTs(tsId, onId);
-    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) == 2);
-}
-
-void SiTable::TestBatGetTableId()
-{
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
-    CPPUNIT_ASSERT(siTable->GetTableId() == BatTableId);
-}
-
-void SiTable::TestBatMakeCodes()
-{
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-    size_t    size;
-
-    static uchar_t buffer[1024];
-    auto_ptr<SiTableInterface> bat1(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
-    uchar_t code1[] = 
-    { 
-        0x4a, 0xf0, 0x1e, 0x00, 0x01, 0xc3, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x11, 0x00, 0x01, 0x00, 0x00, 
-        0xf0, 0x0b, 0x41, 0x09, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0xef, 0xec, 0x08, 
-        0x9c
-    };
-    bat1->AddTs(tsId, onId);
-    bat1->AddTsDescriptor(tsId, string("4109000301000201000101"));
-    bat1->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(memcmp(buffer, code1, bat1->GetCodesSize(BatTableId, tsId, 0)) == 0);
-    bat1->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(memcmp(buffer, code1, bat1->GetCodesSize(BatTableId, tsId, 0)) == 0);
-
-    auto_ptr<SiTableInterface> bat2(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
-    uchar_t code2[] = 
-    { 
-        0x4a, 0xf3, 0xfd, 0x00, 0x01, 0xc3, 0x00, 0x00, 0xf3, 0xf0, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
-        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
-        0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43,
-        0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41,
-        0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
-        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
-        0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43,
-        0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41,
-        0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
-        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
-        0x46, 0x47, 0xfe, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xf0, 0x00, 0xa1, 0x6e, 0xe0, 0xbb
-    };
-
-    uint_t desSize = 50;
-    uint_t desNumber = (MaxBatDesAndTsContentSize - 2) / desSize;
-    // "FE30000102030405060708091011121314151617181920212223242526272829303132333435363738394041424344454647"
-    string descriptor50 = GetDescriptorString(desSize);
-    for (uint_t i = 0; i < desNumber; ++i)
-    {
-        bat2->AddDescriptor(descriptor50);
-    }
-    // "FE06000102030405"
-    string descriptor8 = GetDescriptorString(MaxBatDesAndTsContentSize - desSize * desNumber);
-    bat2->AddDescriptor(descriptor8);
-    size = bat2->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == bat2->GetCodesSize(BatTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, bat2->GetCodesSize(BatTableId, tsId, 0)) == 0);
-    size = bat2->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == bat2->GetCodesSize(BatTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, bat2->GetCodesSize(BatTableId, tsId, 0)) == 0);
-
-    uchar_t code3[] = 
-    { 
-        0x4a, 0xf0, 0x13, 0x00, 0x01, 0xc3, 0x01, 0x01, 0xf0, 0x00, 0xf0, 0x06, 0x00, 0x01, 0x00, 0x00,
-        0xf0, 0x00, 0xd5, 0x20, 0xe9, 0xf6
-    };
-    bat2->AddTs(tsId, onId);
-    size = bat2->MakeCodes(BatTableId, tsId, buffer, 1024, 1);
-    CPPUNIT_ASSERT(size == bat2->GetCodesSize(BatTableId, tsId, 1));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, bat2->GetCodesSize(BatTableId, tsId, 1)) == 0);
-}
-
-void SiTable::TestEitGetCodesSize()
-{
-    ServiceId serviceId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-    size_t    size;
-
-    static uchar_t buffer[4096];
-    /************* case 1 *************/
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
-                                                                          serviceId, version, 
-                                                                          tsId, onId));
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="EIT" TableID="0x4E">
-	    <Transportstream TSID="1" ONID="201" Version="1" ServiceID="1">
-		    <Nothing />
-	    </Transportstream>
-    </Root>
-    */
-    size = siTable->GetCodesSize(EitActualSchTableId, tsId, 0);
-    CPPUNIT_ASSERT(size == sizeof(event_information_section));
-
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="EIT" TableID="0x4E">
-	    <Transportstream TSID="1" ONID="0" Version="1" ServiceID="1">
-		    <Event EventID="1" StartTime="2017-01-01 00:00:00" Duration="003600" 
-                   running_status="4" free_CA_mode="1">
-			    <Descriptors Sum="0">
-			    </Descriptors>
-		    </Event>
-	    </Transportstream>
-    </Root>
-    */
-    EventId eventId = 1;
-    siTable->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
-    size = siTable->GetCodesSize(EitActualSchTableId, tsId, 0);
-    CPPUNIT_ASSERT(size == sizeof(event_information_section) + sizeof(event_information_section_detail));
-
-    size_t descriptorSize = 42;
-    uint_t i;
-    // add descriptor to eventId 1.
-    for (i = 0; i < 50; ++i)
-    {
-        siTable->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
-    }
-
-    // add descriptor to eventId 2.
-    eventId = 2;
-    siTable->AddEvent(eventId, "2017-01-01 00:01:00", 3600, 4, 1);
-    for (i = 0; i < 46; ++i)
-    {
-        siTable->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
-    }
-    eventId = 3;
-    siTable->AddEvent(eventId, "2017-01-01 00:02:00", 3600, 4, 1);
-    siTable->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
-    size = siTable->GetCodesSize(EitActualPfTableId, tsId, 0);
-
-    uint_t eventNumber = 1;
-    uint_t desciptorNumber = 50;
-    if (MaxEventNumberIn1EitPfSection != 1)
-    {
-        eventNumber = 2;
-        desciptorNumber = 96;        
-    }
-    CPPUNIT_ASSERT(size == descriptorSize * desciptorNumber
-                           + sizeof(event_information_section)
-                           + sizeof(event_information_section_detail) * eventNumber);
-    
-    size = siTable->GetCodesSize(EitActualSchTableId, tsId, 0); 
-    CPPUNIT_ASSERT(size == descriptorSize * 96
-                           + sizeof(event_information_section)
-                           + sizeof(event_information_section_detail) * 2);
-
-    uint_t secNumber = siTable->GetSecNumber(EitActualSchTableId, tsId);
-    CPPUNIT_ASSERT(secNumber == 2);
-    size = siTable->GetCodesSize(EitActualSchTableId, tsId, secNumber - 1);
-    CPPUNIT_ASSERT(size == descriptorSize * 1
-                           + sizeof(event_information_section)
-                           + sizeof(event_information_section_detail));
-}
-
-void SiTable::TestEitMakeCodes1()
-{
-    ServiceId serviceId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-    size_t    size;
-
-    static uchar_t buffer[4096];
-    /************* case 1 *************/
-    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
-                                                                       serviceId, version, 
-                                                                       tsId, onId));
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="EIT" TableID="0x4E">
-	    <Transportstream TSID="1" ONID="0" Version="1" ServiceID="1">
-		    <Event EventID="1" StartTime="2017-01-01 00:00:00" Duration="003600" 
-		           running_status="4" free_CA_mode="1">
-			    <Descriptors Sum="0">
-			    </Descriptors>
-		    </Event>
-	    </Transportstream>
-    </Root>
-    */
-    EventId eventId = 1;
-    eit1->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
-    eit1->AddEventDescriptor(eventId, GetDescriptorString(4));    
-    uchar_t code1[4096] = 
-    { 
-        0x4e, 0xf0, 0x1f, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x01,
-        0xe1, 0x99, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x04, 0xfe, 0x02, 0x00, 0x01, 0x1d, 0xdb,
-        0xab, 0xb0
-    };
-    size = eit1->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
-    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualPfTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
-    size = eit1->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
-    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualPfTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);  
-}
-
-void SiTable::TestEitMakeCodes2()
-{
-    ServiceId serviceId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-    size_t    size;
-
-    static uchar_t buffer[4096];
-    /************* case 2 *************/
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
-                                                                       serviceId, version, 
-                                                                       tsId, onId));
-    EventId eventId = 1;
-    uint_t i;
-    siTable->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
-    for (i = 0; i < 50; ++i)
-    {
-        siTable->AddEventDescriptor(eventId, GetDescriptorString(42));
-    }
-    eventId = 2;
-    siTable->AddEvent(eventId, "2017-01-01 00:01:00", 3600, 4, 1);
-    for (i = 0; i < 46; ++i)
-    {
-        siTable->AddEventDescriptor(eventId, GetDescriptorString(42));
-    }
-    eventId = 3;
-    siTable->AddEvent(eventId, "2017-01-01 00:02:00", 3600, 4, 1);
-    siTable->AddEventDescriptor(eventId, GetDescriptorString(42));
-
-    /* write Eit table content into xml file. If needed, we can send this xml to wireshark. */
-    std::fstream eitXml("eit.xml", ios_base::out);
-    eitXml << "<?xml version='1.0'  encoding='gb2312' ?>" << endl;
-    eitXml << "<Root TableType='EIT' TableID='0x4E'>" << endl;    
-    eitXml << string(4, ' ') << "<Transportstream TSID='1' ONID='0' ServiceID='1' Version='1'>" << endl;
-    /* Event 1*/
-    eitXml << string(8, ' ') << "<Event EventID='1' StartTime='2017-01-01 00:00:00' Duration='003600' running_status='4' free_CA_mode='1'>" << endl;
-    eitXml << string(12, ' ') << "<Descriptors>" << endl;
-    for (i = 0; i < 50; ++i)
-    {
-        eitXml << string(16, ' ') << "<Item" << setw(2) << setfill('0') << i+1
-               << " Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
-    }
-    eitXml << string(12, ' ') << "</Descriptors>" << endl;
-    eitXml << string(8, ' ') << "</Event>" << endl;
-    /* Event 2*/
-    eitXml << string(8, ' ') << "<Event EventID='2' StartTime='2017-01-01 00:01:00' Duration='003600' running_status='4' free_CA_mode='1'>" << endl;
-    eitXml << string(12, ' ') << "<Descriptors>" << endl;
-    for (i = 0; i < 46; ++i)
-    {
-        eitXml << string(16, ' ') << "<Item" << setw(2) << setfill('0') << i+1
-               << " Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
-    }
-    eitXml << string(12, ' ') << "</Descriptors>" << endl;
-    eitXml << string(8, ' ') << "</Event>" << endl;
-    /* Event 3*/    
-    eitXml << string(8, ' ') << "<Event EventID='3' StartTime='2017-01-01 00:02:00' Duration='003600' running_status='4' free_CA_mode='1'>" << endl;
-    eitXml << string(12, ' ') << "<Descriptors>" << endl;
-    eitXml << string(16, ' ') << "<Item01 Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
-    eitXml << string(12, ' ') << "</Descriptors>" << endl;
-    eitXml << string(8, ' ') << "</Event>" << endl;
-
-    eitXml << string(4, ' ') << "</Transportstream>" << endl;
-    eitXml << "</Root>" << endl;
-
-    eitXml.close();
-    remove("eit.xml");
-
-    static uchar_t code1[4096] = 
-    { 
-        // cc = 8
-        0x4e, 0xff, 0xe7, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x01,
-        0xe1, 0x99, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x98, 0x34, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        // cc = 9
-        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
-        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
-        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
-        // cc = 10
-        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
-        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-        // cc = 11
-        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
-        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
-        // cc = 12
-        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-        // cc = 13
-        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        // cc = 14
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        // cc = 15
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        // cc = 00
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        // cc = 01
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        // cc = 02
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        // cc = 03
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x02, 0xe1, 0x99, 0x16, 0x01, 0x00, 0x01, 0x00,
-        0x00, 0x97, 0x8c, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
-        // cc = 04
-        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
-        // cc = 05
-        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
-        // cc = 06
-        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
-        // cc = 07
-        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
-        // cc = 08
-        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
-        // cc = 09
-        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
-        // cc = 10
-        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
-        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
-        // cc = 11
-        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
-        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
-        // cc = 12
-        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
-        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
-        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
-        // cc = 13
-        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
-        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
-        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
-        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
-        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
-        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
-        // cc = 14
-        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
-        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xe4, 0x6c, 0xec, 0xaf
-    };
-
-#if MaxEventNumberIn1EitPfTable == 2
-    size = siTable->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualPfTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
-    size = siTable->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualPfTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
-#endif
-
-    static uchar_t code2[4096] = 
-    {
-        0x50, 0xff, 0xe7, 0x00, 0x01, 0xc3, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
-        0xe1, 0x99, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x98, 0x34, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x02,
-        0xe1, 0x99, 0x16, 0x01, 0x00, 0x01, 0x00, 0x00, 0x97, 0x8c, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0xfd, 0xbb, 0x50
-    };
-    uint_t secNumber = siTable->GetSecNumber(EitActualSchTableId, tsId);
-    CPPUNIT_ASSERT(secNumber == 2);
-    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
-    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
-    
-    static uchar_t code3[1024] = 
-    {
-        0x50, 0xf0, 0x45, 0x00, 0x01, 0xc3, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03,
-        0xe1, 0x99, 0x16, 0x02, 0x00, 0x01, 0x00, 0x00, 0x90, 0x2a, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x33, 0xbb, 0x83, 0x96
-    };
-    secNumber = siTable->GetSecNumber(EitActualSchTableId, tsId);
-    CPPUNIT_ASSERT(secNumber == 2);
-    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 1);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 1));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
-    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 1);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 1));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
-}
-
-void SiTable::TestEitRefreshCatch()
-{
-    /* write Eit table content into xml file. If needed, we can send this xml to wireshark. */
-    std::fstream eitXml("eit.xml", ios_base::out);
-    const string eitTxt = 
-        "<?xml version='1.0'  encoding='gb2312' ?>"
-        "<Root TableType='EIT' TableID='0x4E'>"
-        "   <Transportstream TSID='1' ONID='1' ServiceID='1' Version='1'>"
-        "       <Event EventID='1' StartTime='2016-01-01 01:00:00' Duration='003600' running_status='4' free_CA_mode='1'>"
-        "            <Descriptors>"
-        "                <Item01 Tag='0x4D' Data='4D0Achi05a01aa00'/>"
-        "            </Descriptors>"
-        "        </Event>"
-        "        <Event EventID='2' StartTime='2020-01-01 02:00:00' Duration='003600' running_status='4' free_CA_mode='1'>"
-        "            <Descriptors>"
-        "                <Item01 Tag='0x4D' Data='4D0Achi05a02aa00'/>"
-        "            </Descriptors>"
-        "        </Event>"
-        "        <Event EventID='3' StartTime='2020-01-01 03:00:00' Duration='003600' running_status='4' free_CA_mode='1'>"
-        "            <Descriptors>"
-        "                <Item01 Tag='0x4D' Data='4D0Achi05a03aa00'/>"
-        "            </Descriptors>"
-        "        </Event>"
-        "    </Transportstream>"
-        "</Root>";
-    eitXml << eitTxt;
-    eitXml.close();
-    remove("eit.xml");
-
-    ServiceId serviceId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 1;
-    size_t    size;
-
-    static uchar_t buffer[1024];
-    /************* case 1 *************/
-    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
-                                                                       serviceId, version, 
-                                                                       tsId, onId));
-
-    EventId eventId = 1;
-    eit1->AddEvent(eventId, "2016-01-01 01:00:00", 3600, 4, 1);
-    eit1->AddEventDescriptor(eventId, string("4D0Achi05a01aa00"));
-    eventId = 2;
-    eit1->AddEvent(eventId, "2020-01-01 02:00:00", 3600, 4, 1);
-    eit1->AddEventDescriptor(eventId, string("4D0Achi05a02aa00"));
-    eventId = 3;
-    eit1->AddEvent(eventId, "2020-01-01 03:00:00", 3600, 4, 1);
-    eit1->AddEventDescriptor(eventId, string("4D0Achi05a03aa00"));
-
-    uchar_t code1[1024] = 
-    { 
-        0x50, 0xf0, 0x5a, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x50, 0x00, 0x01,
-        0xe0, 0x2b, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06,
-        0x13, 0x61, 0x30, 0x31, 0x61, 0x61, 0x00, 0x00, 0x02, 0xe5, 0xe0, 0x18, 0x00, 0x00, 0x01, 0x00,
-        0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06, 0x13, 0x61, 0x30, 0x32, 0x61, 0x61, 0x00,
-        0x00, 0x03, 0xe5, 0xe0, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68,
-        0x69, 0x06, 0x13, 0x61, 0x30, 0x33, 0x61, 0x61, 0x00, 0xc9, 0x0c, 0x95, 0xe7
-    };
-    size = eit1->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualSchTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
-
-    eit1->RefreshCatch();
-    uchar_t code2[1024] = 
-    { 
-        0x50, 0xf0, 0x41, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x50, 0x00, 0x02,
-        0xe5, 0xe0, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06,
-        0x13, 0x61, 0x30, 0x32, 0x61, 0x61, 0x00, 0x00, 0x03, 0xe5, 0xe0, 0x19, 0x00, 0x00, 0x01, 0x00,
-        0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06, 0x13, 0x61, 0x30, 0x33, 0x61, 0x61, 0x00,
-        0xb7, 0x4a, 0x74, 0x93
-    };
-    size = eit1->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualSchTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
-}
-
- void SiTable::TestNitMakeCodes()
- {
-     /* write Eit table content into xml file. If needed, we can send this xml to wireshark. */
-    std::fstream nitXml("nit.xml", ios_base::out);
-    nitXml << "<?xml version='1.0'  encoding='gb2312' ?>" << endl;
-    nitXml << "<Root TableType='NIT' TableID='0x40'>" << endl;    
-    nitXml << string(4, ' ') << "<Network ID='1' Version='4'>" << endl;
-    nitXml << string(8, ' ') << "<Descriptors Sum='1'>" << endl;
-    nitXml << string(12, ' ') << "<Item1 Tag='0x40' Data='4005abcde'/>" << endl;
-    nitXml << string(8, ' ') << "</Descriptors>" << endl;
-    for (uint_t i = 0; i < 10; ++i)
-    {
-        nitXml << string(8, ' ') << "<Transportstream TSID='" << i+1 << "' ONID='1'>" << endl;
-        nitXml << string(12, ' ') << "<Descriptors>" << endl;
-        for (uint_t j = 0; j < 5; ++j)
-        {
-            nitXml << string(16, ' ') << "<Item" << setw(2) << setfill('0') << j+1
-                   << " Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
-        }
-        nitXml << string(12, ' ') << "</Descriptors>" << endl;
-        nitXml << string(8, ' ') << "</Transportstream>" << endl;
-    }
-    nitXml << string(4, ' ') << "</Network>" << endl;
-    nitXml << "</Root>" << endl;
-    nitXml.close();
-    remove("nit.xml");
-
-    TableId tableId = 0x40;
-    NetId networkId = 1;
-    Version versionNumbe = 4;
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateNitInstance(tableId, networkId, versionNumbe));
-    siTable->AddDescriptor(string("4005abcde"));
-    for (uint_t i = 0; i < 10; ++i)
-    {
-        siTable->AddTs(i + 1, 1);
-        for (uint_t j = 0; j < 5; ++j)
-        {
-            siTable->AddTsDescriptor(i + 1,GetDescriptorString(42));
-        }
-    }
-
-    static uchar_t code1[1024] =
-    {
-        0x40, 0xf3, 0x75, 0x00, 0x01, 0xc9, 0x00, 0x02, 0xf0, 0x08, 0x40, 0x06, 0x13, 0x61, 0x62, 0x63,
-        0x64, 0x65, 0xf3, 0x60, 0x00, 0x01, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x02, 0x00, 0x01,
-        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x00, 0x03, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x04, 0x00, 0x01,
-        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x31, 0xee, 0x72, 0x56
-    };
-
-    size_t size;
-    static uchar_t buffer[1024];
-    TsId tsId = 1;
-    uint_t secNumber = siTable->GetSecNumber(tableId, tsId);
-    CPPUNIT_ASSERT(secNumber == 3);
-    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
-    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
-
-    static uchar_t code2[1024] =
-    {
-        0x40, 0xf3, 0x6d, 0x00, 0x01, 0xc9, 0x01, 0x02, 0xf0, 0x00, 0xf3, 0x60, 0x00, 0x05, 0x00, 0x01,
-        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x00, 0x06, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x07, 0x00, 0x01,
-        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x00, 0x08, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x7d, 0x86, 0x52, 0x6a
-    };
-    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 1);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 1));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
-    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 1);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 1));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
-
-    static uchar_t code3[1024] =
-    {
-        0x40, 0xf1, 0xbd, 0x00, 0x01, 0xc9, 0x02, 0x02, 0xf0, 0x00, 0xf1, 0xb0, 0x00, 0x09, 0x00, 0x01,
-        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
-        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
-        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0x00, 0x0a, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
-        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
-        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
-        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
-        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
-        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
-        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
-        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x5b, 0xec, 0x89, 0x13
-    };
-    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 2);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 2));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
-    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 2);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 2));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
- }
-
-void SiTable::TestSdtConstruct()
-{    
-    TsId    tsId = 1;
-    Version version = 1;
-    NetId   onId = 1;
-
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateSdtInstance(InvalidSiTableTableId, tsId, version, onId);
-	CPPUNIT_ASSERT(siTable == nullptr);
-
-    siTable = SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId);
-    CPPUNIT_ASSERT(siTable != nullptr);
-    delete siTable;
-}
-
-void SiTable::TestSdtGetCodesSize()
-{
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 1;
-    size_t    size;
-
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="SDT" TableID="0x42">
-	    <Transportstream TSID="1" ONID="1" Version="0">
-		    <Nothing />
-	    </Transportstream>
-    </Root>
-     */
-    size = siTable->GetCodesSize(SdtActualTableId, tsId, 0);
-    CPPUNIT_ASSERT(size == sizeof(service_description_section));
-
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="SDT" TableID="0x42">
-	    <Transportstream TSID="1" ONID="1" Version="1">
-		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
-                     running_status="4" free_CA_mode="0">
-			    <Descriptors Sum="0">
-			    </Descriptors>
-		    </Service>
-	    </Transportstream>
-    </Root>
-     */
-    ServiceId serviceId = 1;
-    uchar_t eitScheduleFlag = 1; 
-    uchar_t eitPresentFollowingFlag = 1; 
-    uint16_t runningStatus = 4;
-    uint16_t freeCaMode = 0;
-    siTable->AddService(serviceId, eitScheduleFlag, eitPresentFollowingFlag, runningStatus, freeCaMode);
-    size = siTable->GetCodesSize(SdtActualTableId, tsId, 0);
-    CPPUNIT_ASSERT(size == sizeof(service_description_section) + sizeof(service_description_section_detail));
-
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="SDT" TableID="0x42">
-	    <Transportstream TSID="1" ONID="1" Version="1">
-		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
-                     running_status="4" free_CA_mode="0">
-			    <Descriptors Sum="0">
-				    <Item1 Tag="0xFE" Data="FE30000102030405060708091011121314151617181920212223242526272829303132333435363738394041424344454647"/>
-			    </Descriptors>
-		    </Service>
-	    </Transportstream>
-    </Root>
-     */    
-    size_t descriptorSize = 50;
-    siTable->AddServiceDescriptor(serviceId, GetDescriptorString(descriptorSize));
-    size = siTable->GetCodesSize(SdtActualTableId, tsId, 0);
-    CPPUNIT_ASSERT(size == sizeof(service_description_section) 
-                           + sizeof(service_description_section_detail)
-                           + descriptorSize);
-}
-
-void SiTable::TestSdtGetKey()
-{
-}
-
-void SiTable::TestSdtGetSecNumber()
-{
-}
-
-void SiTable::TestSdtGetTableId()
-{
-}
-
-void SiTable::TestSdtMakeCodes()
-{
-    
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 1;
-    size_t    size;
-
-    static uchar_t buffer[1024];
-
-    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="SDT" TableID="0x42">
-	    <Transportstream TSID="1" ONID="1" Version="0">
-		    <Nothing />
-	    </Transportstream>
-    </Root>
-     */
-    uchar_t code1[] = 
-    { 
-        0x42, 0xf0, 0x0c, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xff, 0x32, 0x21, 0xb1, 0x33
-    };
-    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);   
-    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);    
-
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="SDT" TableID="0x42">
-	    <Transportstream TSID="1" ONID="1" Version="1">
-		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
-                     running_status="4" free_CA_mode="0">
-			    <Descriptors Sum="0">
-			    </Descriptors>
-		    </Service>
-	    </Transportstream>
-    </Root>
-     */
-    ServiceId serviceId = 1;
-    uchar_t eitScheduleFlag = 1; 
-    uchar_t eitPresentFollowingFlag = 1; 
-    uint16_t runningStatus = 4;
-    uint16_t freeCaMode = 0;
-    siTable->AddService(serviceId, eitScheduleFlag, eitPresentFollowingFlag, runningStatus, freeCaMode);
-    uchar_t code2[] = 
-    { 
-        0x42, 0xf0, 0x11, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x00,
-        0x42, 0x41, 0x3d, 0x04
-    };
-    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0); 
-    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0); 
-
-    /*
-    <?xml version='1.0'  encoding='gb2312' ?>
-    <Root TableType="SDT" TableID="0x42">
-	    <Transportstream TSID="1" ONID="1" Version="1">
-		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
-                     running_status="4" free_CA_mode="0">
-			    <Descriptors Sum="0">
-				    <Item1 Tag="0xFE" Data="FE30000102030405060708091011121314151617181920212223242526272829303132333435363738394041424344454647"/>
-			    </Descriptors>
-		    </Service>
-	    </Transportstream>
-    </Root>
-     */
-    size_t descriptorSize = 50;
-    siTable->AddServiceDescriptor(serviceId, GetDescriptorString(descriptorSize));   
-    uchar_t code3[] = 
-    { 
-        0x42, 0xf0, 0x43, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x32,
-        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
-        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
-        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
-        0x46, 0x47, 0xc4, 0x9e, 0xb2, 0x05
-    }; 
-    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0); 
-    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
-    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
-    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0); 
-}
-
-CxxEndNameSpace
+#include "Include/Foundation/SystemInclude.h"
+#include <cppunit/extensions/HelperMacros.h>
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/Crc32.h"
+#include "Include/Foundation/Time.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+
+#include "DescriptorHelper.h"
+#include "UtSiTable.h"
+using namespace std;
+
+CxxBeginNameSpace(UnitTest)
+    
+/**********************class SiTable**********************/
+CPPUNIT_TEST_SUITE_REGISTRATION(SiTable);
+
+void SiTable::TestBatConstruct()
+{    
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(InvalidSiTableTableId, bouquetId, version);
+	CPPUNIT_ASSERT(siTable == nullptr);
+
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    CPPUNIT_ASSERT(siTable != nullptr);
+    delete siTable;
+}
+
+void SiTable::TestBatGetCodes()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    uchar_t   buffer[MaxBatSectionLength];
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    for (uint_t i = 0; i < 200; ++i)
+    {
+        siTable->AddTs(i + 1, onId);
+    }
+    CPPUNIT_ASSERT(siTable->GetCodes(InvalidSiTableTableId, tsId, 0) == nullptr);
+
+    uint_t secNumber = siTable->GetSecNumber(BatTableId, tsId);
+    CPPUNIT_ASSERT(secNumber > 1);
+    for (uint_t i = 0; i < secNumber; ++i)
+    {
+        /* the codes are kept by the table, same as MakeCodes(). */
+        const uchar_t *codes = siTable->GetCodes(BatTableId, tsId, i);
+        size_t size = siTable->GetCodesSize(BatTableId, tsId, i);
+        CPPUNIT_ASSERT(codes != nullptr && codes == siTable->GetCodes(BatTableId, tsId, i));
+        CPPUNIT_ASSERT(siTable->MakeCodes(BatTableId, tsId, buffer, sizeof(buffer), i) == size);
+        CPPUNIT_ASSERT(memcmp(codes, buffer, size) == 0);
+
+        /* crc32 of a section with its CRC_32 field is 0, calculated piece by piece. */
+        uint32_t crc = Crc32::CalculateCrc(codes, 10);
+        CPPUNIT_ASSERT(Crc32::UpdateCrc(crc, codes + 10, size - 10) == 0);
+    }
+}
+
+void SiTable::TestBatGetCodesSize()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 0) == sizeof(bouquet_association_section));
+
+    uint_t desSize = 100;
+    uint_t desNumber = (MaxBatDesAndTsContentSize - 2) / desSize;
+    for (uint_t i = 0; i < desNumber; ++i)
+    {
+        siTable->AddDescriptor(GetDescriptorString(desSize));
+    }
+    siTable->AddDescriptor(GetDescriptorString(MaxBatDesAndTsContentSize - desSize * desNumber));
+    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 0) == MaxBatSectionLength);
+
+    siTable->AddTs(tsId, onId);
+    size_t size = sizeof(bouquet_association_section) + sizeof(transport_stream);
+    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 0) == MaxBatSectionLength);
+    CPPUNIT_ASSERT(siTable->GetCodesSize(BatTableId, tsId, 1) == size);
+}
+
+void SiTable::TestBatGetKey()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    CPPUNIT_ASSERT(siTable->GetKey() == bouquetId);
+}
+
+void SiTable::TestBatGetSecNumber()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    CPPUNIT_ASSERT(siTable->GetSecNumber(InvalidSiTableTableId, tsId) == 0);
+    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) == 1);
+
+    uint_t desSize = 100;
+    uint_t desNumber = (MaxBatDesAndTsContentSize - 2) / desSize;
+    for (uint_t i = 0; i < desNumber; ++i)
+    {
+        siTable->AddDescriptor(GetDescriptorString(desSize));
+    }
+    siTable->AddDescriptor(GetDescriptorString(MaxBatDesAndTsContentSize - desSize * desNumber));
+    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) == 1);
+
+    siTable->AddTs(tsId, onId);
+    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) == 2);
+}
+
+void SiTable::TestBatGetTableId()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    CPPUNIT_ASSERT(siTable->GetTableId() == BatTableId);
+}
+
+void SiTable::TestBatMakeCodes()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    size_t    size;
+
+    static uchar_t buffer[1024];
+    auto_ptr<SiTableInterface> bat1(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    uchar_t code1[] = 
+    { 
+        0x4a, 0xf0, 0x1e, 0x00, 0x01, 0xc3, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x11, 0x00, 0x01, 0x00, 0x00, 
+        0xf0, 0x0b, 0x41, 0x09, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0xef, 0xec, 0x08, 
+        0x9c
+    };
+    bat1->AddTs(tsId, onId);
+    bat1->AddTsDescriptor(tsId, string("4109000301000201000101"));
+    bat1->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(memcmp(buffer, code1, bat1->GetCodesSize(BatTableId, tsId, 0)) == 0);
+    bat1->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(memcmp(buffer, code1, bat1->GetCodesSize(BatTableId, tsId, 0)) == 0);
+
+    auto_ptr<SiTableInterface> bat2(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    uchar_t code2[] = 
+    { 
+        0x4a, 0xf3, 0xfd, 0x00, 0x01, 0xc3, 0x00, 0x00, 0xf3, 0xf0, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+        0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43,
+        0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41,
+        0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+        0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43,
+        0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41,
+        0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0xfe, 0x30,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+        0x46, 0x47, 0xfe, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xf0, 0x00, 0xa1, 0x6e, 0xe0, 0xbb
+    };
+
+    uint_t desSize = 50;
+    uint_t desNumber = (MaxBatDesAndTsContentSize - 2) / desSize;
+    // "FE30000102030405060708091011121314151617181920212223242526272829303132333435363738394041424344454647"
+    string descriptor50 = GetDescriptorString(desSize);
+    for (uint_t i = 0; i < desNumber; ++i)
+    {
+        bat2->AddDescriptor(descriptor50);
+    }
+    // "FE06000102030405"
+    string descriptor8 = GetDescriptorString(MaxBatDesAndTsContentSize - desSize * desNumber);
+    bat2->AddDescriptor(descriptor8);
+    size = bat2->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == bat2->GetCodesSize(BatTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, bat2->GetCodesSize(BatTableId, tsId, 0)) == 0);
+    size = bat2->MakeCodes(BatTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == bat2->GetCodesSize(BatTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, bat2->GetCodesSize(BatTableId, tsId, 0)) == 0);
+
+    uchar_t code3[] = 
+    { 
+        0x4a, 0xf0, 0x13, 0x00, 0x01, 0xc3, 0x01, 0x01, 0xf0, 0x00, 0xf0, 0x06, 0x00, 0x01, 0x00, 0x00,
+        0xf0, 0x00, 0xd5, 0x20, 0xe9, 0xf6
+    };
+    bat2->AddTs(tsId, onId);
+    size = bat2->MakeCodes(BatTableId, tsId, buffer, 1024, 1);
+    CPPUNIT_ASSERT(size == bat2->GetCodesSize(BatTableId, tsId, 1));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, bat2->GetCodesSize(BatTableId, tsId, 1)) == 0);
+}
+
+/* the sections of a big table are laid out in one pass, every section is made at its
+   own offset and no transport stream is lost or repeated.
+ */
+void SiTable::TestBatSectionLayout()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    uint_t    tsNumber = 500;
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    siTable->AddDescriptor(GetDescriptorString(100));
+    for (uint_t i = 0; i < tsNumber; ++i)
+    {
+        siTable->AddTs((TsId)(i + 1), onId);
+        siTable->AddTsDescriptor((TsId)(i + 1), string("4109000301000201000101"));
+    }
+
+    uint_t secNumber = siTable->GetSecNumber(BatTableId, tsId);
+    CPPUNIT_ASSERT(secNumber > 2);
+
+    static uchar_t buffer[MaxBatSectionLength];
+    uint_t nextTsId = 1;
+    for (uint_t i = 0; i < secNumber; ++i)
+    {
+        size_t size = siTable->GetCodesSize(BatTableId, tsId, (SectionNumber)i);
+        CPPUNIT_ASSERT(size <= MaxBatSectionLength);
+        CPPUNIT_ASSERT(siTable->MakeCodes(BatTableId, tsId, buffer, sizeof(buffer), (SectionNumber)i) == size);
+        CPPUNIT_ASSERT((((buffer[1] & 0x0f) << 8) | buffer[2]) + 3 == size);
+        CPPUNIT_ASSERT(buffer[6] == i && buffer[7] == secNumber - 1);
+
+        /* bouquet descriptors only in first section. */
+        size_t desLength = ((buffer[8] & 0x0f) << 8) | buffer[9];
+        CPPUNIT_ASSERT(desLength == (i == 0 ? 100 : 0));
+        uchar_t *ptr = buffer + 10 + desLength;
+        uchar_t *end = ptr + 2 + (((ptr[0] & 0x0f) << 8) | ptr[1]);
+        for (ptr = ptr + 2; ptr < end; ptr = ptr + 6 + (((ptr[4] & 0x0f) << 8) | ptr[5]))
+        {
+            CPPUNIT_ASSERT(((ptr[0] << 8) | ptr[1]) == nextTsId);
+            ++nextTsId;
+        }
+        CPPUNIT_ASSERT(ptr == end && end + 4 == buffer + size);
+    }
+    CPPUNIT_ASSERT(nextTsId == tsNumber + 1);
+}
+
+void SiTable::TestEitGetCodesSize()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    size_t    size;
+
+    static uchar_t buffer[4096];
+    /************* case 1 *************/
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                          serviceId, version, 
+                                                                          tsId, onId));
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="EIT" TableID="0x4E">
+	    <Transportstream TSID="1" ONID="201" Version="1" ServiceID="1">
+		    <Nothing />
+	    </Transportstream>
+    </Root>
+    */
+    size = siTable->GetCodesSize(EitActualSchTableId, tsId, 0);
+    CPPUNIT_ASSERT(size == sizeof(event_information_section));
+
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="EIT" TableID="0x4E">
+	    <Transportstream TSID="1" ONID="0" Version="1" ServiceID="1">
+		    <Event EventID="1" StartTime="2017-01-01 00:00:00" Duration="003600" 
+                   running_status="4" free_CA_mode="1">
+			    <Descriptors Sum="0">
+			    </Descriptors>
+		    </Event>
+	    </Transportstream>
+    </Root>
+    */
+    EventId eventId = 1;
+    siTable->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
+    size = siTable->GetCodesSize(EitActualSchTableId, tsId, 0);
+    CPPUNIT_ASSERT(size == sizeof(event_information_section) + sizeof(event_information_section_detail));
+
+    size_t descriptorSize = 42;
+    uint_t i;
+    // add descriptor to eventId 1.
+    for (i = 0; i < 50; ++i)
+    {
+        siTable->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
+    }
+
+    // add descriptor to eventId 2.
+    eventId = 2;
+    siTable->AddEvent(eventId, "2017-01-01 00:01:00", 3600, 4, 1);
+    for (i = 0; i < 46; ++i)
+    {
+        siTable->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
+    }
+    eventId = 3;
+    siTable->AddEvent(eventId, "2017-01-01 00:02:00", 3600, 4, 1);
+    siTable->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
+    size = siTable->GetCodesSize(EitActualPfTableId, tsId, 0);
+
+    uint_t eventNumber = 1;
+    uint_t desciptorNumber = 50;
+    if (MaxEventNumberIn1EitPfSection != 1)
+    {
+        eventNumber = 2;
+        desciptorNumber = 96;        
+    }
+    CPPUNIT_ASSERT(size == descriptorSize * desciptorNumber
+                           + sizeof(event_information_section)
+                           + sizeof(event_information_section_detail) * eventNumber);
+    
+    size = siTable->GetCodesSize(EitActualSchTableId, tsId, 0); 
+    CPPUNIT_ASSERT(size == descriptorSize * 96
+                           + sizeof(event_information_section)
+                           + sizeof(event_information_section_detail) * 2);
+
+    uint_t secNumber = siTable->GetSecNumber(EitActualSchTableId, tsId);
+    CPPUNIT_ASSERT(secNumber == 2);
+    size = siTable->GetCodesSize(EitActualSchTableId, tsId, secNumber - 1);
+    CPPUNIT_ASSERT(size == descriptorSize * 1
+                           + sizeof(event_information_section)
+                           + sizeof(event_information_section_detail));
+
+    /************* case 2 *************/
+    /* descriptors beyond MaxEitEventDescriptorSize are dropped, running_status and 
+       free_CA_mode are kept.
+     */
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    eventId = 1;
+    eit2->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
+    for (i = 0; i < 100; ++i)
+    {
+        eit2->AddEventDescriptor(eventId, GetDescriptorString(descriptorSize));
+    }
+    uint_t maxDesciptorNumber = MaxEitEventDescriptorSize / descriptorSize;
+    size = eit2->GetCodesSize(EitActualPfTableId, tsId, 0);
+    CPPUNIT_ASSERT(size == descriptorSize * maxDesciptorNumber
+                           + sizeof(event_information_section)
+                           + sizeof(event_information_section_detail));
+
+    size = eit2->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
+    uchar_t *detail = buffer + sizeof(event_information_section) - 4;  /* skip CRC_32 */
+    uint16_t statusAndSize = (detail[10] << 8) | detail[11];
+    CPPUNIT_ASSERT((statusAndSize >> 13) == 4);
+    CPPUNIT_ASSERT(((statusAndSize >> 12) & 0x1) == 1);
+    CPPUNIT_ASSERT((statusAndSize & 0xFFF) == descriptorSize * maxDesciptorNumber);
+}
+
+void SiTable::TestEitGetContentFingerprint()
+{
+    ServiceId serviceId = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[4096], buffer2[4096];
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, 1, 
+                                                                       tsId, onId));
+    eit1->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+
+    /* only the version is different. */
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, 2, 
+                                                                       tsId, onId));
+    eit2->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit2->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+    CPPUNIT_ASSERT(eit1->GetFingerprint() != eit2->GetFingerprint());
+    CPPUNIT_ASSERT(eit1->GetContentFingerprint() == eit2->GetContentFingerprint());
+
+    /* different descriptor. */
+    auto_ptr<SiTableInterface> eit3(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, 1, 
+                                                                       tsId, onId));
+    eit3->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit3->AddEventDescriptor(1, string("4D0Achi05a02aa00"));
+    CPPUNIT_ASSERT(eit1->GetContentFingerprint() != eit3->GetContentFingerprint());
+
+    /* the encoded sections get the new version, fingerprints are not changed. */
+    uint64_t fingerprint = eit1->GetFingerprint();
+    eit1->MakeCodes(EitActualSchTableId, tsId, buffer1, 4096, 0);
+    eit1->SetVersion(2);
+    CPPUNIT_ASSERT(eit1->GetVersion() == 2);
+    CPPUNIT_ASSERT(eit1->GetFingerprint() == fingerprint);
+    size1 = eit1->MakeCodes(EitActualSchTableId, tsId, buffer1, 4096, 0);
+    size2 = eit2->MakeCodes(EitActualSchTableId, tsId, buffer2, 4096, 0);
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+}
+
+void SiTable::TestEitGetFingerprint()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    eit1->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+
+    /* same content, same fingerprint. */
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    eit2->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit2->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+    CPPUNIT_ASSERT(eit1->GetFingerprint() == eit2->GetFingerprint());
+
+    /* different descriptor. */
+    auto_ptr<SiTableInterface> eit3(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    eit3->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit3->AddEventDescriptor(1, string("4D0Achi05a02aa00"));
+    CPPUNIT_ASSERT(eit1->GetFingerprint() != eit3->GetFingerprint());
+
+    /* different version. */
+    auto_ptr<SiTableInterface> eit4(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version + 1, 
+                                                                       tsId, onId));
+    eit4->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit4->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+    CPPUNIT_ASSERT(eit1->GetFingerprint() != eit4->GetFingerprint());
+}
+
+void SiTable::TestEitHorizon()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+
+    SiTableInterface::SetEitHorizon(2 * 24 * 3600);
+    auto_ptr<SiTableInterface> eit(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                      serviceId, version, 
+                                                                      tsId, onId));
+
+    /* event 3 starts 3 days later, it is out of the horizon of 2 days. */
+    time_t now = time(nullptr);
+    time_t startTimes[] = {now - 600, now + 24 * 3600, now + 72 * 3600};
+    for (EventId eventId = 1; eventId <= 3; ++eventId)
+    {
+        char startTime[32];
+        strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTimes[eventId - 1]));
+        eit->AddEvent(eventId, startTime, 7 * 24 * 3600, 4, 1);
+    }
+    CPPUNIT_ASSERT(eit->GetSecNumber(EitActualSchTableId, tsId) == 1);
+    CPPUNIT_ASSERT(eit->GetCodesSize(EitActualSchTableId, tsId, 0) 
+                   == sizeof(event_information_section) + 2 * sizeof(event_information_section_detail));
+
+    /* event 3 moves into the horizon 1 day later. */
+    CPPUNIT_ASSERT(eit->GetNextBoundary() == now + 24 * 3600);
+
+    /* the window is updated by RefreshCatch(). */
+    SiTableInterface::SetEitHorizon(0);
+    CPPUNIT_ASSERT(eit->GetCodesSize(EitActualSchTableId, tsId, 0) 
+                   == sizeof(event_information_section) + 2 * sizeof(event_information_section_detail));
+    eit->RefreshCatch();
+    CPPUNIT_ASSERT(eit->GetCodesSize(EitActualSchTableId, tsId, 0) 
+                   == sizeof(event_information_section) + 3 * sizeof(event_information_section_detail));
+    CPPUNIT_ASSERT(eit->GetNextBoundary() == now - 600 + 7 * 24 * 3600);
+}
+
+void SiTable::TestEitInherit()
+{
+    ServiceId serviceId = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[4096], buffer2[4096];
+    /* 700 events fill 3 schedule sections, the last event is in the last section. */
+    time_t now = time(nullptr);
+    auto createEit = [&](Version version, time_t lastDuration) -> SiTableInterface *
+    {
+        SiTableInterface *eit = SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                    serviceId, version, 
+                                                                    tsId, onId);
+        for (EventId eventId = 1; eventId <= 700; ++eventId)
+        {
+            char startTime[32];
+            time_t start = now + (eventId - 1) * 600;
+            strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&start));
+            eit->AddEvent(eventId, startTime, (eventId == 700 ? lastDuration : 600), 4, 1);
+        }
+        return eit;
+    };
+
+    auto_ptr<SiTableInterface> oldEit(createEit(1, 600));
+    uint_t secNumber = oldEit->GetSecNumber(EitActualSchTableId, tsId);
+    CPPUNIT_ASSERT(secNumber == 3);
+    for (uint_t i = 0; i < secNumber; ++i)
+    {
+        oldEit->MakeCodes(EitActualSchTableId, tsId, buffer1, 4096, i);
+    }
+
+    /* the last section is changed, the version of the file is not, the table gets a new
+       version, the reused sections are same as the ones made from scratch.
+     */
+    auto_ptr<SiTableInterface> newEit(createEit(1, 1200));
+    auto_ptr<SiTableInterface> refEit(createEit(2, 1200));
+    newEit->Inherit(*oldEit);
+    CPPUNIT_ASSERT(newEit->GetSecNumber(EitActualSchTableId, tsId) == secNumber);
+    for (uint_t i = 0; i < secNumber; ++i)
+    {
+        size1 = newEit->MakeCodes(EitActualSchTableId, tsId, buffer1, 4096, i);
+        size2 = refEit->MakeCodes(EitActualSchTableId, tsId, buffer2, 4096, i);
+        CPPUNIT_ASSERT(size1 == size2);
+        CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+    }
+    CPPUNIT_ASSERT(buffer1[5] == ((Reserved2Bit << 6) | (2 << 1) | 1));
+    for (uint_t i = 0; i < newEit->GetSecNumber(EitActualPfTableId, tsId); ++i)
+    {
+        size1 = newEit->MakeCodes(EitActualPfTableId, tsId, buffer1, 4096, i);
+        size2 = refEit->MakeCodes(EitActualPfTableId, tsId, buffer2, 4096, i);
+        CPPUNIT_ASSERT(size1 == size2);
+        CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+    }
+
+    /* nothing is changed, the table keeps the version on air. */
+    auto_ptr<SiTableInterface> sameEit(createEit(5, 600));
+    sameEit->Inherit(*oldEit);
+    TableId tableIds[] = {EitActualSchTableId, EitActualPfTableId};
+    for (size_t i = 0; i < sizeof(tableIds) / sizeof(TableId); ++i)
+    {
+        secNumber = oldEit->GetSecNumber(tableIds[i], tsId);
+        CPPUNIT_ASSERT(sameEit->GetSecNumber(tableIds[i], tsId) == secNumber);
+        for (uint_t j = 0; j < secNumber; ++j)
+        {
+            size1 = sameEit->MakeCodes(tableIds[i], tsId, buffer1, 4096, j);
+            size2 = oldEit->MakeCodes(tableIds[i], tsId, buffer2, 4096, j);
+            CPPUNIT_ASSERT(size1 == size2);
+            CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+        }
+    }
+}
+
+void SiTable::TestEitInterleavedDescriptor()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[4096], buffer2[4096];
+    /* descriptors are added event by event. */
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    eit1->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+    eit1->AddEventDescriptor(1, GetDescriptorString(42));
+    eit1->AddEvent(2, "2020-01-01 02:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(2, string("4D0Achi05a02aa00"));
+    eit1->AddEventDescriptor(2, GetDescriptorString(20));
+
+    /* descriptors of event 1 and event 2 are added alternately. */
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    eit2->AddEvent(1, "2020-01-01 01:00:00", 3600, 4, 1);
+    eit2->AddEvent(2, "2020-01-01 02:00:00", 3600, 4, 1);
+    eit2->AddEventDescriptor(1, string("4D0Achi05a01aa00"));
+    eit2->AddEventDescriptor(2, string("4D0Achi05a02aa00"));
+    eit2->AddEventDescriptor(1, GetDescriptorString(42));
+    eit2->AddEventDescriptor(2, GetDescriptorString(20));
+
+    CPPUNIT_ASSERT(eit1->GetSecNumber(EitActualSchTableId, tsId) == eit2->GetSecNumber(EitActualSchTableId, tsId));
+    size1 = eit1->MakeCodes(EitActualSchTableId, tsId, buffer1, 4096, 0);
+    size2 = eit2->MakeCodes(EitActualSchTableId, tsId, buffer2, 4096, 0);
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+
+    size1 = eit1->MakeCodes(EitActualPfTableId, tsId, buffer1, 4096, 1);
+    size2 = eit2->MakeCodes(EitActualPfTableId, tsId, buffer2, 4096, 1);
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+}
+
+void SiTable::TestEitMakeCodes1()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    size_t    size;
+
+    static uchar_t buffer[4096];
+    /************* case 1 *************/
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="EIT" TableID="0x4E">
+	    <Transportstream TSID="1" ONID="0" Version="1" ServiceID="1">
+		    <Event EventID="1" StartTime="2017-01-01 00:00:00" Duration="003600" 
+		           running_status="4" free_CA_mode="1">
+			    <Descriptors Sum="0">
+			    </Descriptors>
+		    </Event>
+	    </Transportstream>
+    </Root>
+    */
+    EventId eventId = 1;
+    eit1->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(eventId, GetDescriptorString(4));    
+    uchar_t code1[4096] = 
+    { 
+        0x4e, 0xf0, 0x1f, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x01,
+        0xe1, 0x99, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x04, 0xfe, 0x02, 0x00, 0x01, 0x1d, 0xdb,
+        0xab, 0xb0
+    };
+    size = eit1->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualPfTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
+    size = eit1->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualPfTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);  
+}
+
+void SiTable::TestEitMakeCodes2()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    size_t    size;
+
+    static uchar_t buffer[4096];
+    /************* case 2 *************/
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    EventId eventId = 1;
+    uint_t i;
+    siTable->AddEvent(eventId, "2017-01-01 00:00:00", 3600, 4, 1);
+    for (i = 0; i < 50; ++i)
+    {
+        siTable->AddEventDescriptor(eventId, GetDescriptorString(42));
+    }
+    eventId = 2;
+    siTable->AddEvent(eventId, "2017-01-01 00:01:00", 3600, 4, 1);
+    for (i = 0; i < 46; ++i)
+    {
+        siTable->AddEventDescriptor(eventId, GetDescriptorString(42));
+    }
+    eventId = 3;
+    siTable->AddEvent(eventId, "2017-01-01 00:02:00", 3600, 4, 1);
+    siTable->AddEventDescriptor(eventId, GetDescriptorString(42));
+
+    /* write Eit table content into xml file. If needed, we can send this xml to wireshark. */
+    std::fstream eitXml("eit.xml", ios_base::out);
+    eitXml << "<?xml version='1.0'  encoding='gb2312' ?>" << endl;
+    eitXml << "<Root TableType='EIT' TableID='0x4E'>" << endl;    
+    eitXml << string(4, ' ') << "<Transportstream TSID='1' ONID='0' ServiceID='1' Version='1'>" << endl;
+    /* Event 1*/
+    eitXml << string(8, ' ') << "<Event EventID='1' StartTime='2017-01-01 00:00:00' Duration='003600' running_status='4' free_CA_mode='1'>" << endl;
+    eitXml << string(12, ' ') << "<Descriptors>" << endl;
+    for (i = 0; i < 50; ++i)
+    {
+        eitXml << string(16, ' ') << "<Item" << setw(2) << setfill('0') << i+1
+               << " Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
+    }
+    eitXml << string(12, ' ') << "</Descriptors>" << endl;
+    eitXml << string(8, ' ') << "</Event>" << endl;
+    /* Event 2*/
+    eitXml << string(8, ' ') << "<Event EventID='2' StartTime='2017-01-01 00:01:00' Duration='003600' running_status='4' free_CA_mode='1'>" << endl;
+    eitXml << string(12, ' ') << "<Descriptors>" << endl;
+    for (i = 0; i < 46; ++i)
+    {
+        eitXml << string(16, ' ') << "<Item" << setw(2) << setfill('0') << i+1
+               << " Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
+    }
+    eitXml << string(12, ' ') << "</Descriptors>" << endl;
+    eitXml << string(8, ' ') << "</Event>" << endl;
+    /* Event 3*/    
+    eitXml << string(8, ' ') << "<Event EventID='3' StartTime='2017-01-01 00:02:00' Duration='003600' running_status='4' free_CA_mode='1'>" << endl;
+    eitXml << string(12, ' ') << "<Descriptors>" << endl;
+    eitXml << string(16, ' ') << "<Item01 Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
+    eitXml << string(12, ' ') << "</Descriptors>" << endl;
+    eitXml << string(8, ' ') << "</Event>" << endl;
+
+    eitXml << string(4, ' ') << "</Transportstream>" << endl;
+    eitXml << "</Root>" << endl;
+
+    eitXml.close();
+    remove("eit.xml");
+
+    static uchar_t code1[4096] = 
+    { 
+        // cc = 8
+        0x4e, 0xff, 0xe7, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x01,
+        0xe1, 0x99, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x98, 0x34, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        // cc = 9
+        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
+        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
+        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
+        // cc = 10
+        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
+        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        // cc = 11
+        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
+        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
+        // cc = 12
+        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        // cc = 13
+        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        // cc = 14
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        // cc = 15
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        // cc = 00
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        // cc = 01
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        // cc = 02
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        // cc = 03
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x02, 0xe1, 0x99, 0x16, 0x01, 0x00, 0x01, 0x00,
+        0x00, 0x97, 0x8c, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+        // cc = 04
+        0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe,
+        // cc = 05
+        0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+        // cc = 06
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30,
+        // cc = 07
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04,
+        // cc = 08
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+        // cc = 09
+        0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+        // cc = 10
+        0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
+        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+        // cc = 11
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
+        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+        // cc = 12
+        0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
+        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
+        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00,
+        // cc = 13
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+        0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+        0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+        0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02,
+        0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34,
+        0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+        // cc = 14
+        0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32,
+        0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xe4, 0x6c, 0xec, 0xaf
+    };
+
+#if MaxEventNumberIn1EitPfTable == 2
+    size = siTable->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualPfTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
+    size = siTable->MakeCodes(EitActualPfTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualPfTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
+#endif
+
+    static uchar_t code2[4096] = 
+    {
+        0x50, 0xff, 0xe7, 0x00, 0x01, 0xc3, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
+        0xe1, 0x99, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x98, 0x34, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x02,
+        0xe1, 0x99, 0x16, 0x01, 0x00, 0x01, 0x00, 0x00, 0x97, 0x8c, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0xfd, 0xbb, 0x50
+    };
+    uint_t secNumber = siTable->GetSecNumber(EitActualSchTableId, tsId);
+    CPPUNIT_ASSERT(secNumber == 2);
+    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
+    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
+    
+    static uchar_t code3[1024] = 
+    {
+        0x50, 0xf0, 0x45, 0x00, 0x01, 0xc3, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03,
+        0xe1, 0x99, 0x16, 0x02, 0x00, 0x01, 0x00, 0x00, 0x90, 0x2a, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x33, 0xbb, 0x83, 0x96
+    };
+    secNumber = siTable->GetSecNumber(EitActualSchTableId, tsId);
+    CPPUNIT_ASSERT(secNumber == 2);
+    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 1);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 1));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
+    size = siTable->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 1);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(EitActualSchTableId, tsId, 1));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
+}
+
+void SiTable::TestEitNextBoundary()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[4096];
+    static uchar_t buffer2[4096];
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    CPPUNIT_ASSERT(eit1->GetNextBoundary() == 0);
+
+    /* event 1 ended 1 hour ago, event 2 is the present event, event 3 is the following one.
+       eit2 has the events of eit1 after event 1 is removed.
+     */
+    time_t now = time(nullptr);
+    time_t startTimes[] = {now - 7200, now - 1800, now + 1800, now + 5400};
+    for (EventId eventId = 1; eventId <= 4; ++eventId)
+    {
+        char startTime[32];
+        strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTimes[eventId - 1]));
+        eit1->AddEvent(eventId, startTime, 3600, 4, 1);
+        if (eventId != 1)
+        {
+            eit2->AddEvent(eventId, startTime, 3600, 4, 1);
+        }
+    }
+    CPPUNIT_ASSERT(eit1->GetNextBoundary() == now - 3600);
+
+    /* p/f of event 1, 2, the p/f of event 2, 3 is made in advance. */
+    CPPUNIT_ASSERT(eit1->GetSecNumber(EitActualPfTableId, tsId) == MaxEventNumberInAllEitPfSection);
+    size1 = eit1->MakeCodes(EitActualPfTableId, tsId, buffer1, 4096, 0);
+    CPPUNIT_ASSERT(buffer1[14] == 0x00 && buffer1[15] == 0x01);
+
+    /* at the boundary, the prepared p/f is swapped in, it is same as the p/f made from 
+       scratch.
+     */
+    eit1->RefreshCatch();
+    CPPUNIT_ASSERT(eit1->GetNextBoundary() == now + 1800);
+    CPPUNIT_ASSERT(eit1->GetSecNumber(EitActualPfTableId, tsId) == eit2->GetSecNumber(EitActualPfTableId, tsId));
+    for (SectionNumber i = 0; i < eit2->GetSecNumber(EitActualPfTableId, tsId); ++i)
+    {
+        size1 = eit1->MakeCodes(EitActualPfTableId, tsId, buffer1, 4096, i);
+        size2 = eit2->MakeCodes(EitActualPfTableId, tsId, buffer2, 4096, i);
+        CPPUNIT_ASSERT(size1 == size2 && size1 == eit1->GetCodesSize(EitActualPfTableId, tsId, i));
+        CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+    }
+    eit1->MakeCodes(EitActualPfTableId, tsId, buffer1, 4096, 0);
+    CPPUNIT_ASSERT(buffer1[14] == 0x00 && buffer1[15] == 0x02);
+}
+
+void SiTable::TestEitOutOfOrderEvent()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[4096];
+    static uchar_t buffer2[4096];
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+
+    /* eit1 gets the events in time order, eit2 gets event 3, 1, 2, 4, the first 2 events 
+       are out of date.
+     */
+    const char *startTimes[] = {"2000-01-01 01:00:00", "2000-01-01 02:00:00", 
+                                "2020-01-01 03:00:00", "2020-01-01 04:00:00"};
+    const char *descriptors[] = {"4D0Achi05a01aa00", "4D0Achi05a02aa00", 
+                                 "4D0Achi05a03aa00", "4D0Achi05a04aa00"};
+    EventId eventIds1[] = {1, 2, 3, 4};
+    EventId eventIds2[] = {3, 1, 2, 4};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        eit1->AddEvent(eventIds1[i], startTimes[eventIds1[i] - 1], 3600, 4, 1);
+        eit1->AddEventDescriptor(eventIds1[i], string(descriptors[eventIds1[i] - 1]));
+        eit2->AddEvent(eventIds2[i], startTimes[eventIds2[i] - 1], 3600, 4, 1);
+    }
+    for (size_t i = 0; i < 4; ++i)
+    {
+        eit2->AddEventDescriptor(eventIds2[i], string(descriptors[eventIds2[i] - 1]));
+    }
+    eit1->Seal();
+    eit2->Seal();
+
+    TableId tableIds[] = {EitActualSchTableId, EitActualPfTableId};
+    for (size_t round = 0; round < 2; ++round)
+    {
+        for (size_t i = 0; i < 2; ++i)
+        {
+            uint_t secNumber = eit1->GetSecNumber(tableIds[i], tsId);
+            CPPUNIT_ASSERT(secNumber == eit2->GetSecNumber(tableIds[i], tsId));
+            for (SectionNumber j = 0; j < secNumber; ++j)
+            {
+                size1 = eit1->MakeCodes(tableIds[i], tsId, buffer1, 4096, j);
+                size2 = eit2->MakeCodes(tableIds[i], tsId, buffer2, 4096, j);
+                CPPUNIT_ASSERT(size1 == size2 && memcmp(buffer1, buffer2, size1) == 0);
+            }
+        }
+
+        /* out of date events are removed from both. */
+        eit1->RefreshCatch();
+        eit2->RefreshCatch();
+    }
+
+    /* the present event is event 3 after out of date events are removed. */
+    eit2->MakeCodes(EitActualPfTableId, tsId, buffer2, 4096, 0);
+    CPPUNIT_ASSERT(buffer2[14] == 0x00 && buffer2[15] == 0x03);
+}
+
+void SiTable::TestEitRefreshCatch()
+{
+    /* write Eit table content into xml file. If needed, we can send this xml to wireshark. */
+    std::fstream eitXml("eit.xml", ios_base::out);
+    const string eitTxt = 
+        "<?xml version='1.0'  encoding='gb2312' ?>"
+        "<Root TableType='EIT' TableID='0x4E'>"
+        "   <Transportstream TSID='1' ONID='1' ServiceID='1' Version='1'>"
+        "       <Event EventID='1' StartTime='2016-01-01 01:00:00' Duration='003600' running_status='4' free_CA_mode='1'>"
+        "            <Descriptors>"
+        "                <Item01 Tag='0x4D' Data='4D0Achi05a01aa00'/>"
+        "            </Descriptors>"
+        "        </Event>"
+        "        <Event EventID='2' StartTime='2020-01-01 02:00:00' Duration='003600' running_status='4' free_CA_mode='1'>"
+        "            <Descriptors>"
+        "                <Item01 Tag='0x4D' Data='4D0Achi05a02aa00'/>"
+        "            </Descriptors>"
+        "        </Event>"
+        "        <Event EventID='3' StartTime='2020-01-01 03:00:00' Duration='003600' running_status='4' free_CA_mode='1'>"
+        "            <Descriptors>"
+        "                <Item01 Tag='0x4D' Data='4D0Achi05a03aa00'/>"
+        "            </Descriptors>"
+        "        </Event>"
+        "    </Transportstream>"
+        "</Root>";
+    eitXml << eitTxt;
+    eitXml.close();
+    remove("eit.xml");
+
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size;
+
+    static uchar_t buffer[1024];
+    /************* case 1 *************/
+    auto_ptr<SiTableInterface> eit1(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+
+    EventId eventId = 1;
+    eit1->AddEvent(eventId, "2016-01-01 01:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(eventId, string("4D0Achi05a01aa00"));
+    eventId = 2;
+    eit1->AddEvent(eventId, "2020-01-01 02:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(eventId, string("4D0Achi05a02aa00"));
+    eventId = 3;
+    eit1->AddEvent(eventId, "2020-01-01 03:00:00", 3600, 4, 1);
+    eit1->AddEventDescriptor(eventId, string("4D0Achi05a03aa00"));
+
+    uchar_t code1[1024] = 
+    { 
+        0x50, 0xf0, 0x5a, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x50, 0x00, 0x01,
+        0xe0, 0x2b, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06,
+        0x13, 0x61, 0x30, 0x31, 0x61, 0x61, 0x00, 0x00, 0x02, 0xe5, 0xe0, 0x18, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06, 0x13, 0x61, 0x30, 0x32, 0x61, 0x61, 0x00,
+        0x00, 0x03, 0xe5, 0xe0, 0x19, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68,
+        0x69, 0x06, 0x13, 0x61, 0x30, 0x33, 0x61, 0x61, 0x00, 0xc9, 0x0c, 0x95, 0xe7
+    };
+    size = eit1->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualSchTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
+
+    eit1->RefreshCatch();
+    uchar_t code2[1024] = 
+    { 
+        0x50, 0xf0, 0x41, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x50, 0x00, 0x02,
+        0xe5, 0xe0, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06,
+        0x13, 0x61, 0x30, 0x32, 0x61, 0x61, 0x00, 0x00, 0x03, 0xe5, 0xe0, 0x19, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x90, 0x0d, 0x4d, 0x0b, 0x63, 0x68, 0x69, 0x06, 0x13, 0x61, 0x30, 0x33, 0x61, 0x61, 0x00,
+        0xb7, 0x4a, 0x74, 0x93
+    };
+    size = eit1->MakeCodes(EitActualSchTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == eit1->GetCodesSize(EitActualSchTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
+}
+
+void SiTable::TestEitSegmentation()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size;
+
+    static uchar_t buffer[4096];
+    static uchar_t codes[4096];
+    SiTableInterface::SetEitSegmentation(true);
+    auto_ptr<SiTableInterface> eit(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                      serviceId, version, 
+                                                                      tsId, onId));
+    /* a service without event has 1 empty section. */
+    CPPUNIT_ASSERT(eit->GetSecNumber(EitActualSchTableId, tsId) == 1);
+    CPPUNIT_ASSERT(eit->GetCodesSize(EitActualSchTableId, tsId, 0) == sizeof(event_information_section));
+
+    /* event 1, 2 are in segment 16 (day 2, 00:00 - 03:00 UTC) of table_id 0x50, 
+       event 3 is in segment 8 (day 5, 00:00 - 03:00 UTC) of table_id 0x51.
+     */
+    time_t now = time(nullptr);
+    time_t origin = now - now % (24 * 3600);
+    time_t startTimes[] = {origin + 48 * 3600, origin + 49 * 3600, origin + 120 * 3600};
+    for (EventId eventId = 1; eventId <= 3; ++eventId)
+    {
+        char startTime[32];
+        strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTimes[eventId - 1]));
+        eit->AddEvent(eventId, startTime, 3600, 4, 1);
+    }
+
+    /* 32 segments of table_id 0x50 and 9 segments of table_id 0x51. */
+    CPPUNIT_ASSERT(eit->GetSecNumber(EitActualSchTableId, tsId) == 41);
+    /* p/f is not segmented. */
+    CPPUNIT_ASSERT(eit->GetSecNumber(EitActualPfTableId, tsId) == MaxEventNumberInAllEitPfSection);
+
+    size = eit->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 0);
+    CPPUNIT_ASSERT(size == sizeof(event_information_section));
+    CPPUNIT_ASSERT(buffer[0] == 0x50 && buffer[6] == 0 && buffer[7] == 248 && buffer[12] == 0 && buffer[13] == 0x51);
+
+    size = eit->MakeCodes(EitActualSchTableId, tsId, codes, 4096, 16);
+    CPPUNIT_ASSERT(size == eit->GetCodesSize(EitActualSchTableId, tsId, 16));
+    CPPUNIT_ASSERT(size == sizeof(event_information_section) + 2 * sizeof(event_information_section_detail));
+    CPPUNIT_ASSERT(codes[0] == 0x50 && codes[6] == 128 && codes[7] == 248 && codes[12] == 128 && codes[13] == 0x51);
+
+    size = eit->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 40);
+    CPPUNIT_ASSERT(size == sizeof(event_information_section) + sizeof(event_information_section_detail));
+    CPPUNIT_ASSERT(buffer[0] == 0x51 && buffer[6] == 64 && buffer[7] == 64 && buffer[12] == 64 && buffer[13] == 0x51);
+
+    /* a new event of table_id 0x51 does not change the sections of table_id 0x50. */
+    char startTime[32];
+    time_t startTime4 = origin + 121 * 3600;
+    strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTime4));
+    eit->AddEvent(4, startTime, 3600, 4, 1);
+    CPPUNIT_ASSERT(eit->GetSecNumber(EitActualSchTableId, tsId) == 41);
+    size = eit->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 16);
+    CPPUNIT_ASSERT(memcmp(buffer, codes, size) == 0);
+    size = eit->MakeCodes(EitActualSchTableId, tsId, buffer, 4096, 40);
+    CPPUNIT_ASSERT(size == sizeof(event_information_section) + 2 * sizeof(event_information_section_detail));
+
+    SiTableInterface::SetEitSegmentation(false);
+    CPPUNIT_ASSERT(eit->GetSecNumber(EitActualSchTableId, tsId) == 1);
+
+    /* a full segment drops its remaining events, even the ones which could fit into its
+       last section.  events 1 - 16 (2028 bytes) fill 8 sections of segment 16, big event 17
+       and small event 18 are dropped, small event 19 is in segment 17.
+     */
+    SiTableInterface::SetEitSegmentation(true);
+    auto_ptr<SiTableInterface> eit2(SiTableInterface::CreateEitInstance(EitActualSchTableId, 
+                                                                       serviceId, version, 
+                                                                       tsId, onId));
+    for (EventId eventId = 1; eventId <= 19; ++eventId)
+    {
+        time_t startTime5 = origin + 48 * 3600 + eventId * 60 + (eventId == 19 ? 3 * 3600 : 0);
+        strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTime5));
+        eit2->AddEvent(eventId, startTime, 60, 4, 1);
+        for (uint_t i = 0; eventId <= 17 && i < 8; ++i)
+        {
+            eit2->AddEventDescriptor(eventId, GetDescriptorString(252));
+        }
+    }
+
+    /* 16 empty segments, 8 sections of segment 16 and 1 section of segment 17. */
+    CPPUNIT_ASSERT(eit2->GetSecNumber(EitActualSchTableId, tsId) == 25);
+    EventId nextEventId = 1;
+    for (SectionNumber i = 16; i < 25; ++i)
+    {
+        size = eit2->MakeCodes(EitActualSchTableId, tsId, buffer, sizeof(buffer), i);
+        CPPUNIT_ASSERT(size == eit2->GetCodesSize(EitActualSchTableId, tsId, i));
+        CPPUNIT_ASSERT((((buffer[1] & 0x0f) << 8) | buffer[2]) + 3 == size);
+        CPPUNIT_ASSERT(buffer[6] == (i < 24 ? 128 + i - 16 : 136) && buffer[12] == (i < 24 ? 135 : 136));
+
+        uchar_t *end = buffer + size - 4;
+        uchar_t *ptr;
+        for (ptr = buffer + 14; ptr < end; ptr = ptr + 12 + (((ptr[10] & 0x0f) << 8) | ptr[11]))
+        {
+            CPPUNIT_ASSERT(((ptr[0] << 8) | ptr[1]) == nextEventId);
+            nextEventId = (nextEventId == 16 ? 19 : nextEventId + 1);
+        }
+        CPPUNIT_ASSERT(ptr == end);
+    }
+    CPPUNIT_ASSERT(nextEventId == 20);
+    SiTableInterface::SetEitSegmentation(false);
+}
+
+ void SiTable::TestNitMakeCodes()
+ {
+     /* write Eit table content into xml file. If needed, we can send this xml to wireshark. */
+    std::fstream nitXml("nit.xml", ios_base::out);
+    nitXml << "<?xml version='1.0'  encoding='gb2312' ?>" << endl;
+    nitXml << "<Root TableType='NIT' TableID='0x40'>" << endl;    
+    nitXml << string(4, ' ') << "<Network ID='1' Version='4'>" << endl;
+    nitXml << string(8, ' ') << "<Descriptors Sum='1'>" << endl;
+    nitXml << string(12, ' ') << "<Item1 Tag='0x40' Data='4005abcde'/>" << endl;
+    nitXml << string(8, ' ') << "</Descriptors>" << endl;
+    for (uint_t i = 0; i < 10; ++i)
+    {
+        nitXml << string(8, ' ') << "<Transportstream TSID='" << i+1 << "' ONID='1'>" << endl;
+        nitXml << string(12, ' ') << "<Descriptors>" << endl;
+        for (uint_t j = 0; j < 5; ++j)
+        {
+            nitXml << string(16, ' ') << "<Item" << setw(2) << setfill('0') << j+1
+                   << " Tag='0xFE' Data='" << GetDescriptorString(42) << "'/>" << endl;
+        }
+        nitXml << string(12, ' ') << "</Descriptors>" << endl;
+        nitXml << string(8, ' ') << "</Transportstream>" << endl;
+    }
+    nitXml << string(4, ' ') << "</Network>" << endl;
+    nitXml << "</Root>" << endl;
+    nitXml.close();
+    remove("nit.xml");
+
+    TableId tableId = 0x40;
+    NetId networkId = 1;
+    Version versionNumbe = 4;
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateNitInstance(tableId, networkId, versionNumbe));
+    siTable->AddDescriptor(string("4005abcde"));
+    for (uint_t i = 0; i < 10; ++i)
+    {
+        siTable->AddTs(i + 1, 1);
+        for (uint_t j = 0; j < 5; ++j)
+        {
+            siTable->AddTsDescriptor(i + 1,GetDescriptorString(42));
+        }
+    }
+
+    static uchar_t code1[1024] =
+    {
+        0x40, 0xf3, 0x75, 0x00, 0x01, 0xc9, 0x00, 0x02, 0xf0, 0x08, 0x40, 0x06, 0x13, 0x61, 0x62, 0x63,
+        0x64, 0x65, 0xf3, 0x60, 0x00, 0x01, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x02, 0x00, 0x01,
+        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x00, 0x03, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x04, 0x00, 0x01,
+        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x31, 0xee, 0x72, 0x56
+    };
+
+    size_t size;
+    static uchar_t buffer[1024];
+    TsId tsId = 1;
+    uint_t secNumber = siTable->GetSecNumber(tableId, tsId);
+    CPPUNIT_ASSERT(secNumber == 3);
+    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
+    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);
+
+    static uchar_t code2[1024] =
+    {
+        0x40, 0xf3, 0x6d, 0x00, 0x01, 0xc9, 0x01, 0x02, 0xf0, 0x00, 0xf3, 0x60, 0x00, 0x05, 0x00, 0x01,
+        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x00, 0x06, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00, 0x07, 0x00, 0x01,
+        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x00, 0x08, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x7d, 0x86, 0x52, 0x6a
+    };
+    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 1);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 1));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
+    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 1);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 1));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0);
+
+    static uchar_t code3[1024] =
+    {
+        0x40, 0xf1, 0xbd, 0x00, 0x01, 0xc9, 0x02, 0x02, 0xf0, 0x00, 0xf1, 0xb0, 0x00, 0x09, 0x00, 0x01,
+        0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01,
+        0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+        0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0x00, 0x0a, 0x00, 0x01, 0xf0, 0xd2, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03,
+        0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+        0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28,
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+        0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+        0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0xfe, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+        0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x5b, 0xec, 0x89, 0x13
+    };
+    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 2);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 2));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
+    size = siTable->MakeCodes(tableId, tsId, buffer, 1024, 2);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(tableId, tsId, 2));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0);
+ }
+
+void SiTable::TestEitShareModel()
+{
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[1024], buffer2[1024];
+    size_t modelNumber = SiTableInterface::GetModelNumber();
+
+    /* eit actual and eit other of same service, loaded from separate files. event 1 is
+       over, event 2 is running, event 3 is the following one.
+     */
+    time_t now = time(nullptr);
+    time_t startTimes[] = {now - 7200, now - 1800, now + 1800};
+    SiTableInterface *eits[2];
+    TableId tableIds[] = {EitActualSchTableId, EitOtherSchTableId};
+    for (uint_t i = 0; i < 2; ++i)
+    {
+        eits[i] = SiTableInterface::CreateEitInstance(tableIds[i], serviceId, version, tsId, onId);
+        for (EventId eventId = 1; eventId <= 3; ++eventId)
+        {
+            char startTime[32];
+            strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTimes[eventId - 1]));
+            eits[i]->AddEvent(eventId, startTime, 3600, 4, 1);
+            eits[i]->AddEventDescriptor(eventId, string("4D0Achi05a01aa00"));
+        }
+        eits[i]->Seal();
+    }
+    auto_ptr<SiTableInterface> eit1(eits[0]), eit2(eits[1]);
+
+    /* one model for both tables. */
+    CPPUNIT_ASSERT(SiTableInterface::GetModelNumber() == modelNumber + 1);
+
+    /* sections differ only in table_id, last_table_id and crc. */
+    size1 = eit1->MakeCodes(EitActualSchTableId, tsId, buffer1, sizeof(buffer1), 0);
+    size2 = eit2->MakeCodes(EitOtherSchTableId, tsId, buffer2, sizeof(buffer2), 0);
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(buffer1[0] == EitActualSchTableId && buffer2[0] == EitOtherSchTableId);
+    CPPUNIT_ASSERT(memcmp(buffer1 + 1, buffer2 + 1, 12) == 0);
+    CPPUNIT_ASSERT(memcmp(buffer1 + 14, buffer2 + 14, size1 - 14 - 4) == 0);
+    CPPUNIT_ASSERT(eit2->GetSecNumber(EitOtherPfTableId, tsId) == MaxEventNumberInAllEitPfSection);
+
+    /* event 1 is removed through eit actual, eit other sees it too. */
+    eit1->RefreshCatch();
+    size1 = eit1->MakeCodes(EitActualSchTableId, tsId, buffer1, sizeof(buffer1), 0);
+    size2 = eit2->MakeCodes(EitOtherSchTableId, tsId, buffer2, sizeof(buffer2), 0);
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(memcmp(buffer1 + 14, buffer2 + 14, size1 - 14 - 4) == 0);
+    CPPUNIT_ASSERT(buffer1[14] == 0x00 && buffer1[15] == 0x02);
+    size1 = eit1->MakeCodes(EitActualPfTableId, tsId, buffer1, sizeof(buffer1), 0);
+    size2 = eit2->MakeCodes(EitOtherPfTableId, tsId, buffer2, sizeof(buffer2), 0);
+    CPPUNIT_ASSERT(size1 == size2 && buffer2[14] == 0x00 && buffer2[15] == 0x02);
+
+    /* the model is not same as its fingerprint any more, it can't be adopted. */
+    CPPUNIT_ASSERT(SiTableInterface::GetModelNumber() == modelNumber);
+}
+
+void SiTable::TestSdtConstruct()
+{    
+    TsId    tsId = 1;
+    Version version = 1;
+    NetId   onId = 1;
+
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateSdtInstance(InvalidSiTableTableId, tsId, version, onId);
+	CPPUNIT_ASSERT(siTable == nullptr);
+
+    siTable = SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId);
+    CPPUNIT_ASSERT(siTable != nullptr);
+    delete siTable;
+}
+
+void SiTable::TestSdtGetCodesSize()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size;
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="SDT" TableID="0x42">
+	    <Transportstream TSID="1" ONID="1" Version="0">
+		    <Nothing />
+	    </Transportstream>
+    </Root>
+     */
+    size = siTable->GetCodesSize(SdtActualTableId, tsId, 0);
+    CPPUNIT_ASSERT(size == sizeof(service_description_section));
+
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="SDT" TableID="0x42">
+	    <Transportstream TSID="1" ONID="1" Version="1">
+		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
+                     running_status="4" free_CA_mode="0">
+			    <Descriptors Sum="0">
+			    </Descriptors>
+		    </Service>
+	    </Transportstream>
+    </Root>
+     */
+    ServiceId serviceId = 1;
+    uchar_t eitScheduleFlag = 1; 
+    uchar_t eitPresentFollowingFlag = 1; 
+    uint16_t runningStatus = 4;
+    uint16_t freeCaMode = 0;
+    siTable->AddService(serviceId, eitScheduleFlag, eitPresentFollowingFlag, runningStatus, freeCaMode);
+    size = siTable->GetCodesSize(SdtActualTableId, tsId, 0);
+    CPPUNIT_ASSERT(size == sizeof(service_description_section) + sizeof(service_description_section_detail));
+
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="SDT" TableID="0x42">
+	    <Transportstream TSID="1" ONID="1" Version="1">
+		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
+                     running_status="4" free_CA_mode="0">
+			    <Descriptors Sum="0">
+				    <Item1 Tag="0xFE" Data="FE30000102030405060708091011121314151617181920212223242526272829303132333435363738394041424344454647"/>
+			    </Descriptors>
+		    </Service>
+	    </Transportstream>
+    </Root>
+     */    
+    size_t descriptorSize = 50;
+    siTable->AddServiceDescriptor(serviceId, GetDescriptorString(descriptorSize));
+    size = siTable->GetCodesSize(SdtActualTableId, tsId, 0);
+    CPPUNIT_ASSERT(size == sizeof(service_description_section) 
+                           + sizeof(service_description_section_detail)
+                           + descriptorSize);
+}
+
+void SiTable::TestSdtGetKey()
+{
+}
+
+void SiTable::TestSdtGetSecNumber()
+{
+}
+
+void SiTable::TestSdtGetTableId()
+{
+}
+
+void SiTable::TestSdtMakeCodes()
+{
+    
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+    size_t    size;
+
+    static uchar_t buffer[1024];
+
+    auto_ptr<SiTableInterface> siTable(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="SDT" TableID="0x42">
+	    <Transportstream TSID="1" ONID="1" Version="0">
+		    <Nothing />
+	    </Transportstream>
+    </Root>
+     */
+    uchar_t code1[] = 
+    { 
+        0x42, 0xf0, 0x0c, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xff, 0x32, 0x21, 0xb1, 0x33
+    };
+    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);   
+    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code1, size) == 0);    
+
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="SDT" TableID="0x42">
+	    <Transportstream TSID="1" ONID="1" Version="1">
+		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
+                     running_status="4" free_CA_mode="0">
+			    <Descriptors Sum="0">
+			    </Descriptors>
+		    </Service>
+	    </Transportstream>
+    </Root>
+     */
+    ServiceId serviceId = 1;
+    uchar_t eitScheduleFlag = 1; 
+    uchar_t eitPresentFollowingFlag = 1; 
+    uint16_t runningStatus = 4;
+    uint16_t freeCaMode = 0;
+    siTable->AddService(serviceId, eitScheduleFlag, eitPresentFollowingFlag, runningStatus, freeCaMode);
+    uchar_t code2[] = 
+    { 
+        0x42, 0xf0, 0x11, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x00,
+        0x42, 0x41, 0x3d, 0x04
+    };
+    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0); 
+    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code2, size) == 0); 
+
+    /*
+    <?xml version='1.0'  encoding='gb2312' ?>
+    <Root TableType="SDT" TableID="0x42">
+	    <Transportstream TSID="1" ONID="1" Version="1">
+		    <Service ServiceID="1" EIT_schedule_flag="1" EIT_present_following_flag="1" 
+                     running_status="4" free_CA_mode="0">
+			    <Descriptors Sum="0">
+				    <Item1 Tag="0xFE" Data="FE30000102030405060708091011121314151617181920212223242526272829303132333435363738394041424344454647"/>
+			    </Descriptors>
+		    </Service>
+	    </Transportstream>
+    </Root>
+     */
+    size_t descriptorSize = 50;
+    siTable->AddServiceDescriptor(serviceId, GetDescriptorString(descriptorSize));   
+    uchar_t code3[] = 
+    { 
+        0x42, 0xf0, 0x43, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x01, 0xff, 0x80, 0x32,
+        0xfe, 0x30, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+        0x46, 0x47, 0xc4, 0x9e, 0xb2, 0x05
+    }; 
+    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0); 
+    size = siTable->MakeCodes(SdtActualTableId, tsId, buffer, 1024, 0);
+    CPPUNIT_ASSERT(size == siTable->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(memcmp(buffer, code3, size) == 0); 
+}
+
+void SiTable::TestSdtSeal()
+{
+    TsId      tsId = 1;
+    Version   version = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[1024], buffer2[1024];
+    /* descriptors are attached through the builder index. */
+    auto_ptr<SiTableInterface> sdt1(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
+    sdt1->AddService(1, 0, 1, 4, 0);
+    sdt1->AddService(2, 0, 1, 4, 0);
+    sdt1->AddServiceDescriptor(2, string("4D0Achi05a02aa00"));
+    sdt1->AddServiceDescriptor(1, string("4D0Achi05a01aa00"));
+    sdt1->Seal();
+
+    /* table is sealed before descriptors are attached, they are attached by linear search. */
+    auto_ptr<SiTableInterface> sdt2(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
+    sdt2->AddService(1, 0, 1, 4, 0);
+    sdt2->AddService(2, 0, 1, 4, 0);
+    sdt2->Seal();
+    sdt2->AddServiceDescriptor(2, string("4D0Achi05a02aa00"));
+    sdt2->AddServiceDescriptor(1, string("4D0Achi05a01aa00"));
+
+    size1 = sdt1->MakeCodes(SdtActualTableId, tsId, buffer1, 1024, 0);
+    size2 = sdt2->MakeCodes(SdtActualTableId, tsId, buffer2, 1024, 0);
+    CPPUNIT_ASSERT(size1 == sdt1->GetCodesSize(SdtActualTableId, tsId, 0));
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(memcmp(buffer1, buffer2, size1) == 0);
+}
+
+void SiTable::TestSdtShareCodes()
+{
+    TsId      tsId = 1;
+    Version   version = 1;
+    OnId      onId = 1;
+    size_t    size;
+
+    static uchar_t buffer[1024];
+    SiTableInterface *sdts[3];
+    for (uint_t i = 0; i < 3; ++i)
+    {
+        /* sdt other of same ts in 3 networks, the last one has another version. */
+        sdts[i] = SiTableInterface::CreateSdtInstance(SdtOtherTableId, tsId, (i == 2 ? version + 1 : version), onId);
+        sdts[i]->AddService(1, 0, 1, 4, 0);
+        sdts[i]->AddServiceDescriptor(1, string("4D0Achi05a01aa00"));
+    }
+    auto_ptr<SiTableInterface> sdt1(sdts[0]), sdt2(sdts[1]), sdt3(sdts[2]);
+
+    /* identical sections are kept once. */
+    const uchar_t *codes = sdt1->GetCodes(SdtOtherTableId, tsId, 0);
+    size = sdt1->MakeCodes(SdtOtherTableId, tsId, buffer, sizeof(buffer), 0);
+    CPPUNIT_ASSERT(sdt2->GetCodes(SdtOtherTableId, tsId, 0) == codes);
+    CPPUNIT_ASSERT(sdt3->GetCodes(SdtOtherTableId, tsId, 0) != codes);
+
+    /* the section lives as long as a table refers to it. */
+    sdt1.reset();
+    CPPUNIT_ASSERT(sdt2->GetCodes(SdtOtherTableId, tsId, 0) == codes);
+    CPPUNIT_ASSERT(memcmp(codes, buffer, size) == 0);
+
+    /* same codes after the version is changed. */
+    sdt3->SetVersion(version);
+    CPPUNIT_ASSERT(sdt3->GetCodes(SdtOtherTableId, tsId, 0) == codes);
+}
+
+void SiTable::TestSdtShareModel()
+{
+    TsId      tsId = 1;
+    Version   version = 1;
+    OnId      onId = 1;
+    size_t    size1, size2;
+
+    static uchar_t buffer1[1024], buffer2[1024], codes[1024];
+    size_t modelNumber = SiTableInterface::GetModelNumber();
+
+    /* sdt actual and sdt other of same ts, loaded from separate files. */
+    SiTableInterface *sdts[2];
+    TableId tableIds[] = {SdtActualTableId, SdtOtherTableId};
+    for (uint_t i = 0; i < 2; ++i)
+    {
+        sdts[i] = SiTableInterface::CreateSdtInstance(tableIds[i], tsId, version, onId);
+        sdts[i]->AddService(1, 0, 1, 4, 0);
+        sdts[i]->AddService(2, 0, 1, 4, 0);
+        sdts[i]->AddServiceDescriptor(1, string("4D0Achi05a01aa00"));
+        sdts[i]->Seal();
+    }
+    auto_ptr<SiTableInterface> sdt1(sdts[0]), sdt2(sdts[1]);
+
+    /* one model for both tables, sections differ only in table_id and crc. */
+    CPPUNIT_ASSERT(SiTableInterface::GetModelNumber() == modelNumber + 1);
+    size1 = sdt1->MakeCodes(SdtActualTableId, tsId, buffer1, sizeof(buffer1), 0);
+    size2 = sdt2->MakeCodes(SdtOtherTableId, tsId, buffer2, sizeof(buffer2), 0);
+    CPPUNIT_ASSERT(size1 == size2);
+    CPPUNIT_ASSERT(buffer1[0] == SdtActualTableId && buffer2[0] == SdtOtherTableId);
+    CPPUNIT_ASSERT(memcmp(buffer1 + 1, buffer2 + 1, size1 - 1 - 4) == 0);
+
+    /* a table changed after Seal() gets a copy of the model, the other one is not changed. */
+    sdt2->AddServiceDescriptor(2, string("4D0Achi05a02aa00"));
+    CPPUNIT_ASSERT(sdt1->MakeCodes(SdtActualTableId, tsId, codes, sizeof(codes), 0) == size1);
+    CPPUNIT_ASSERT(memcmp(codes, buffer1, size1) == 0);
+    CPPUNIT_ASSERT(sdt2->GetCodesSize(SdtOtherTableId, tsId, 0) > size2);
+
+    /* models are released with the last table. */
+    sdt1.reset();
+    sdt2.reset();
+    CPPUNIT_ASSERT(SiTableInterface::GetModelNumber() == modelNumber);
+}
+
+/* time of GetCodesSize() and MakeCodes() of every section of a bat with 3000 ts and
+   an sdt with 3000 services, all sections are made again after each version change.
+   the time is printed only, it depends on the machine and the build.
+ */
+void SiTable::TestSectionLayoutTiming()
+{
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    uint_t    number = 3000;
+    uint_t    roundNumber = 200;
+
+    auto_ptr<SiTableInterface> bat(SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version));
+    bat->AddDescriptor(GetDescriptorString(100));
+    auto_ptr<SiTableInterface> sdt(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
+    for (uint_t i = 0; i < number; ++i)
+    {
+        bat->AddTs((TsId)(i + 1), onId);
+        bat->AddTsDescriptor((TsId)(i + 1), string("4109000301000201000101"));
+        sdt->AddService((ServiceId)(i + 1), 0, 1, 4, 0);
+    }
+
+    SiTableInterface *siTables[] = {bat.get(), sdt.get()};
+    TableId tableIds[] = {BatTableId, SdtActualTableId};
+    static uchar_t buffer[MaxBatSectionLength];
+    for (uint_t k = 0; k < 2; ++k)
+    {
+        TimeMeter timeMeter;
+        uint_t secNumber = 0;
+        timeMeter.Start();
+        for (uint_t round = 0; round < roundNumber; ++round)
+        {
+            siTables[k]->SetVersion((Version)(round % 32));
+            secNumber = siTables[k]->GetSecNumber(tableIds[k], tsId);
+            for (uint_t i = 0; i < secNumber; ++i)
+            {
+                size_t size = siTables[k]->GetCodesSize(tableIds[k], tsId, (SectionNumber)i);
+                CPPUNIT_ASSERT(siTables[k]->MakeCodes(tableIds[k], tsId, buffer, sizeof(buffer), (SectionNumber)i) == size);
+            }
+        }
+        timeMeter.End();
+        CPPUNIT_ASSERT(secNumber > 1);
+
+        double duration = (double)timeMeter.GetDuration().count() * 1000;
+        cout << "table_id 0x" << hex << (uint_t)tableIds[k] << dec << ", " << secNumber << " sections, " 
+             << duration / roundNumber / secNumber << " us per section" << endl;
+    }
+}
+
+CxxEndNameSpace
@@ -1,253 +1,509 @@
-#include "Include/Foundation/SystemInclude.h"
-#include <cppunit/extensions/HelperMacros.h>
-
-/* Foundation */
-#include "Include/Foundation/Type.h"
-#include "Include/Foundation/Debug.h"
-#include "Include/Foundation/PacketHelper.h"
-
-/* TsPacketSiTable */
-#include "Include/TsPacketSiTable/SiTableInterface.h"
-#include "Include/TsPacketSiTable/TransportPacketInterface.h"
-
-#include "DescriptorHelper.h"
-#include "UtSiTable.h"
-#include "UtTransportPacket.h"
-using namespace std;
-
-CxxBeginNameSpace(UnitTest)
-
-/**********************class TransportPacket**********************/
-CPPUNIT_TEST_SUITE_REGISTRATION(TransportPacket);
-void TransportPacket::TestTransportPacketConstruct()
-{
-    NetId netId = 1;
-    TransportPacketInterface *tsPacket;
-
-    tsPacket = TransportPacketInterface::CreateInstance(netId, InvalidPid);
-    CPPUNIT_ASSERT(tsPacket == nullptr);
-
-    tsPacket = TransportPacketInterface::CreateInstance(netId, BatPid);
-    CPPUNIT_ASSERT(tsPacket != nullptr);
-    delete tsPacket;
-}
-
-void TransportPacket::TestTransportPacketAddSiTable()
-{
-    NetId netId = 1;
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
-    tsPacket->AddSiTable(siTable);
-    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId) != nullptr);
-}
-
-void TransportPacket::TestTransportPacketDelSiTable()
-{
-    NetId netId = 1;
-    BouquetId bouquetId1 = 1;
-    BouquetId bouquetId2 = 2;
-    Version   version = 1;
-
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId1, version);
-    tsPacket->AddSiTable(siTable);    
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId2, version);
-    tsPacket->AddSiTable(siTable);
-
-    tsPacket->DelSiTable(BatTableId, bouquetId1);
-    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId1) == nullptr);
-    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId2) != nullptr);
-
-    tsPacket->DelSiTable(BatTableId, bouquetId2);
-    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId1) == nullptr);
-    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId2) == nullptr);
-}
-
-void TransportPacket::TestTransportPacketFindSiTable()
-{
-    TestTransportPacketAddSiTable();
-    TestTransportPacketDelSiTable();
-}
-
-void TransportPacket::TestTransportPacketGetCodesSize()
-{
-    NetId netId = 1;
-    BouquetId bouquetId = 1;
-    Version   version = 1;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-    
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == 0);
-
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
-    tsPacket->AddSiTable(siTable);
-    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == TsPacketSize);
-
-    //-1 for pointer_field
-    size_t size = MaxTsPacketPayloadSize - 1 - sizeof(bouquet_association_section);
-    siTable->AddDescriptor(GetDescriptorString(size));
-    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == TsPacketSize);
-
-    siTable->AddDescriptor(GetDescriptorString(2));
-    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == TsPacketSize * 2);
-}
-
-void TransportPacket::TestTransportPacketGetNetId()
-{
-    NetId     netId = 1;
-    BouquetId bouquetId = 2;
-    Version   version = 3;
-    
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-    CPPUNIT_ASSERT(tsPacket->GetNetId() == netId);
-}
-
-void TransportPacket::TestTransportPacketGetPid()
-{
-    NetId     netId = 1;
-    BouquetId bouquetId = 2;
-    Version   version = 3;
-    
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-    CPPUNIT_ASSERT(tsPacket->GetPid() == BatPid);
-}
-
-/* SiTable with only one section */
-void TransportPacket::TestTransportPacketMakeCodes1()
-{
-    NetId     netId = 1;
-    BouquetId bouquetId = 2;
-    Version   version = 3;
-    TsId      tsId = 1;
-    OnId      onId = 0;
-    
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-    static uchar_t buffer[2048];
-
-    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == 0);
-
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
-    tsPacket->AddSiTable(siTable);
-
-    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == TsPacketSize);
-    uchar_t code1[] = { 0x47, 0x40, 0x11, 0x10 };
-    CPPUNIT_ASSERT(memcmp(buffer, code1, 4) == 0);
-
-    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == TsPacketSize);
-    uchar_t code2[] = { 0x47, 0x40, 0x11, 0x11 };
-    CPPUNIT_ASSERT(memcmp(buffer, code2, 4) == 0);
-
-    //-1 for pointer_field
-    size_t size = MaxTsPacketPayloadSize - 1 - sizeof(bouquet_association_section);
-    siTable->AddDescriptor(GetDescriptorString(size));
-    siTable->AddDescriptor(GetDescriptorString(2));
-    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == TsPacketSize * 2);
-    uchar_t code3[] = { 0x47, 0x40, 0x11, 0x12 };
-    uchar_t code4[] = { 0x47, 0x00, 0x11, 0x13 };
-    CPPUNIT_ASSERT(memcmp(buffer, code3, 4) == 0);
-    CPPUNIT_ASSERT(memcmp(buffer + TsPacketSize, code4, 4) == 0);
-}
-
-/* SiTable with two or more sections, and performance test!!! */
-void TransportPacket::TestTransportPacketMakeCodes2()
-{
-    NetId     netId = 1;
-    BouquetId bouquetId = 2;
-    Version   version = 3;
-    
-    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
-    #define MaxBufferSize (1024 * 16)
-    static uchar_t buffer[MaxBufferSize];
-
-    uchar_t code[] = { 0x47, 0x40, 0x11, 0x10, 0x00 };
-    SiTableInterface *siTable;
-    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
-    tsPacket->AddSiTable(siTable);
-
-    uint_t tansportStreamNumber = 200;  //1300
-    uint_t sectionUnitTsNumber = MaxBatDesAndTsContentSize / sizeof(transport_stream);
-    uint_t headSectionNumber = tansportStreamNumber / sectionUnitTsNumber;
-    uint_t tailSectionNumber = (tansportStreamNumber % sectionUnitTsNumber) == 0 ? 0 : 1;
-    size_t headSectionUnitSize = sizeof(transport_stream) * sectionUnitTsNumber
-                             + sizeof(bouquet_association_section)
-                             + 1;  //+1 for pointer_field
-    size_t tailSectionSize = (tansportStreamNumber - sectionUnitTsNumber * headSectionNumber) * sizeof(transport_stream)
-                             + sizeof(bouquet_association_section);
-    uint_t headSectionUnitPacketNumber = (headSectionUnitSize + TsPacketSize - 1) / TsPacketSize;
-    uint_t tailSectionUnitPacketNumber = (tailSectionSize + TsPacketSize - 1) / TsPacketSize;
-    size_t tsPacketNumber = headSectionUnitPacketNumber * headSectionNumber + tailSectionUnitPacketNumber;
-    
-    TsId      tsId = 1;
-    OnId      onId = 0;
-
-    for (uint_t i = 0; i < tansportStreamNumber; ++i)
-    {
-        TsId tsId = i + 1;
-        siTable->AddTs(tsId, onId);
-    }
-
-    size_t codeSize = tsPacket->GetCodesSize(BatTableId, tsId);
-    CPPUNIT_ASSERT(codeSize == TsPacketSize * tsPacketNumber);
-    CPPUNIT_ASSERT(codeSize == tsPacket->MakeCodes(0, BatTableId, tsId, buffer, MaxBufferSize));
-        
-    for (uint_t i = 1; i < tsPacketNumber; ++i)
-    {
-        size_t cmpSize;
-        if (i % headSectionUnitPacketNumber == 0)
-        {
-            cmpSize = 5;
-            code[1] = 0x40;
-        }
-        else
-        {
-            cmpSize = 4;
-            code[1] = 0x00;
-        }
-        code[3] = 0x10 | (0x0F & i);
-        CPPUNIT_ASSERT(memcmp(buffer + 188 * i, code, cmpSize) == 0);
-    }
-}
-
-/**********************class TransportPackets**********************/
-CPPUNIT_TEST_SUITE_REGISTRATION(TransportPackets);
-void TransportPackets::TestTransportPacketsBegin()
-{
-    auto_ptr<TransportPacketsInterface> tsPackets(TransportPacketsInterface::CreateInstance());
-    CPPUNIT_ASSERT(tsPackets->Begin() == tsPackets->End());
-
-    NetId     netId = 1;
-    BouquetId bouquetId = 2;
-    Version   version = 3;
-    
-    TransportPacketInterface *tsPacket = TransportPacketInterface::CreateInstance(netId, BatPid);
-    tsPackets->Add(tsPacket);
-    CPPUNIT_ASSERT(tsPackets->Begin() != tsPackets->End());
-    uint_t count = 0;
-    TransportPacketsInterface::iterator iter;
-    for (iter = tsPackets->Begin(); iter != tsPackets->End(); ++iter)
-    {
-        count++;
-    }
-    CPPUNIT_ASSERT(count == 1);
-
-    iter = tsPackets->Find(netId, BatPid);
-    CPPUNIT_ASSERT(iter != tsPackets->End());
-
-    iter = tsPackets->Find(netId + 1, BatPid);
-    CPPUNIT_ASSERT(iter == tsPackets->End());
-
-    iter = tsPackets->Find(netId, InvalidPid);
-    CPPUNIT_ASSERT(iter == tsPackets->End());
-}
-
+#include "Include/Foundation/SystemInclude.h"
+#include <cppunit/extensions/HelperMacros.h>
+
+/* Foundation */
+#include "Include/Foundation/Type.h"
+#include "Include/Foundation/Debug.h"
+#include "Include/Foundation/PacketHelper.h"
+
+/* TsPacketSiTable */
+#include "Include/TsPacketSiTable/SiTableInterface.h"
+#include "Include/TsPacketSiTable/TransportPacketInterface.h"
+
+#include "DescriptorHelper.h"
+#include "UtSiTable.h"
+#include "UtTransportPacket.h"
+using namespace std;
+
+CxxBeginNameSpace(UnitTest)
+
+/**********************class TransportPacket**********************/
+CPPUNIT_TEST_SUITE_REGISTRATION(TransportPacket);
+void TransportPacket::TestTransportPacketConstruct()
+{
+    NetId netId = 1;
+    TransportPacketInterface *tsPacket;
+
+    tsPacket = TransportPacketInterface::CreateInstance(netId, InvalidPid);
+    CPPUNIT_ASSERT(tsPacket == nullptr);
+
+    tsPacket = TransportPacketInterface::CreateInstance(netId, BatPid);
+    CPPUNIT_ASSERT(tsPacket != nullptr);
+    delete tsPacket;
+}
+
+void TransportPacket::TestTransportPacketAddSiTable()
+{
+    NetId netId = 1;
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    tsPacket->AddSiTable(siTable);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId) != nullptr);
+}
+
+void TransportPacket::TestTransportPacketDelSiTable()
+{
+    NetId netId = 1;
+    BouquetId bouquetId1 = 1;
+    BouquetId bouquetId2 = 2;
+    Version   version = 1;
+
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId1, version);
+    tsPacket->AddSiTable(siTable);    
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId2, version);
+    tsPacket->AddSiTable(siTable);
+
+    tsPacket->DelSiTable(BatTableId, bouquetId1);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId1) == nullptr);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId2) != nullptr);
+
+    tsPacket->DelSiTable(BatTableId, bouquetId2);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId1) == nullptr);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(BatTableId, bouquetId2) == nullptr);
+}
+
+void TransportPacket::TestTransportPacketFindSiTable()
+{
+    TestTransportPacketAddSiTable();
+    TestTransportPacketDelSiTable();
+}
+
+void TransportPacket::TestTransportPacketGetCodesSize()
+{
+    NetId netId = 1;
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == 0);
+
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    tsPacket->AddSiTable(siTable);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == TsPacketSize);
+
+    //-1 for pointer_field
+    size_t size = MaxTsPacketPayloadSize - 1 - sizeof(bouquet_association_section);
+    siTable->AddDescriptor(GetDescriptorString(size));
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == TsPacketSize);
+
+    siTable->AddDescriptor(GetDescriptorString(2));
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId,tsId) == TsPacketSize * 2);
+}
+
+void TransportPacket::TestTransportPacketGetNetId()
+{
+    NetId     netId = 1;
+    BouquetId bouquetId = 2;
+    Version   version = 3;
+    
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+    CPPUNIT_ASSERT(tsPacket->GetNetId() == netId);
+}
+
+void TransportPacket::TestTransportPacketGetPid()
+{
+    NetId     netId = 1;
+    BouquetId bouquetId = 2;
+    Version   version = 3;
+    
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+    CPPUNIT_ASSERT(tsPacket->GetPid() == BatPid);
+}
+
+/* SiTable with only one section */
+void TransportPacket::TestTransportPacketMakeCodes1()
+{
+    NetId     netId = 1;
+    BouquetId bouquetId = 2;
+    Version   version = 3;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+    
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+    static uchar_t buffer[2048];
+
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == 0);
+
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    tsPacket->AddSiTable(siTable);
+
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == TsPacketSize);
+    uchar_t code1[] = { 0x47, 0x40, 0x11, 0x10 };
+    CPPUNIT_ASSERT(memcmp(buffer, code1, 4) == 0);
+
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == TsPacketSize);
+    uchar_t code2[] = { 0x47, 0x40, 0x11, 0x11 };
+    CPPUNIT_ASSERT(memcmp(buffer, code2, 4) == 0);
+
+    //-1 for pointer_field
+    size_t size = MaxTsPacketPayloadSize - 1 - sizeof(bouquet_association_section);
+    siTable->AddDescriptor(GetDescriptorString(size));
+    siTable->AddDescriptor(GetDescriptorString(2));
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, BatTableId, tsId, buffer, 2048) == TsPacketSize * 2);
+    uchar_t code3[] = { 0x47, 0x40, 0x11, 0x12 };
+    uchar_t code4[] = { 0x47, 0x00, 0x11, 0x13 };
+    CPPUNIT_ASSERT(memcmp(buffer, code3, 4) == 0);
+    CPPUNIT_ASSERT(memcmp(buffer + TsPacketSize, code4, 4) == 0);
+}
+
+/* SiTable with two or more sections, and performance test!!! */
+void TransportPacket::TestTransportPacketMakeCodes2()
+{
+    NetId     netId = 1;
+    BouquetId bouquetId = 2;
+    Version   version = 3;
+    
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+    #define MaxBufferSize (1024 * 16)
+    static uchar_t buffer[MaxBufferSize];
+
+    uchar_t code[] = { 0x47, 0x40, 0x11, 0x10, 0x00 };
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    tsPacket->AddSiTable(siTable);
+
+    uint_t tansportStreamNumber = 200;  //1300
+    uint_t sectionUnitTsNumber = MaxBatDesAndTsContentSize / sizeof(transport_stream);
+    uint_t headSectionNumber = tansportStreamNumber / sectionUnitTsNumber;
+    uint_t tailSectionNumber = (tansportStreamNumber % sectionUnitTsNumber) == 0 ? 0 : 1;
+    size_t headSectionUnitSize = sizeof(transport_stream) * sectionUnitTsNumber
+                             + sizeof(bouquet_association_section)
+                             + 1;  //+1 for pointer_field
+    size_t tailSectionSize = (tansportStreamNumber - sectionUnitTsNumber * headSectionNumber) * sizeof(transport_stream)
+                             + sizeof(bouquet_association_section);
+    uint_t headSectionUnitPacketNumber = (headSectionUnitSize + TsPacketSize - 1) / TsPacketSize;
+    uint_t tailSectionUnitPacketNumber = (tailSectionSize + TsPacketSize - 1) / TsPacketSize;
+    size_t tsPacketNumber = headSectionUnitPacketNumber * headSectionNumber + tailSectionUnitPacketNumber;
+    
+    TsId      tsId = 1;
+    OnId      onId = 0;
+
+    for (uint_t i = 0; i < tansportStreamNumber; ++i)
+    {
+        TsId tsId = i + 1;
+        siTable->AddTs(tsId, onId);
+    }
+
+    size_t codeSize = tsPacket->GetCodesSize(BatTableId, tsId);
+    CPPUNIT_ASSERT(codeSize == TsPacketSize * tsPacketNumber);
+    CPPUNIT_ASSERT(codeSize == tsPacket->MakeCodes(0, BatTableId, tsId, buffer, MaxBufferSize));
+        
+    for (uint_t i = 1; i < tsPacketNumber; ++i)
+    {
+        size_t cmpSize;
+        if (i % headSectionUnitPacketNumber == 0)
+        {
+            cmpSize = 5;
+            code[1] = 0x40;
+        }
+        else
+        {
+            cmpSize = 4;
+            code[1] = 0x00;
+        }
+        code[3] = 0x10 | (0x0F & i);
+        CPPUNIT_ASSERT(memcmp(buffer + 188 * i, code, cmpSize) == 0);
+    }
+}
+
+void TransportPacket::TestTransportPacketSectionTiers()
+{
+    NetId     netId = 1;
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, EitPid));
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateEitInstance(EitActualSchTableId, serviceId, version, tsId, onId);
+    tsPacket->AddSiTable(siTable);
+
+    /* 3 sections, each section has 339 events without descriptor, the first events
+       start 1 hour, 2 days and 4 days later.
+     */
+    time_t now = time(nullptr);
+    time_t sectionTimes[] = {now + 3600, now + 3600 * 48, now + 3600 * 96};
+    EventId eventId = 1;
+    for (uint_t i = 0; i < 3; ++i)
+    {
+        for (uint_t j = 0; j < 339; ++j)
+        {
+            time_t startTime = sectionTimes[i] + j * 60;
+            char buffer[32];
+            strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", localtime(&startTime));
+            siTable->AddEvent(eventId++, buffer, 60, 4, 1);
+        }
+    }
+    CPPUNIT_ASSERT(siTable->GetSecNumber(EitActualSchTableId, tsId) == 3);
+    size_t sectionSize = tsPacket->GetCodesSize(EitActualSchTableId, tsId) / 3;
+
+    SectionTiers tiers;
+    tiers.push_back(make_pair(24 * 3600, 1));
+    tiers.push_back(make_pair(72 * 3600, 2));
+    tiers.push_back(make_pair(0, 4));
+    tsPacket->SetSectionTiers(tiers);
+
+    /* section 0 is sent every round, section 1 every 2 rounds, section 2 every 4 rounds. */
+    uint_t sectionNumbers[] = {3, 1, 2, 1, 3, 1, 2, 1};
+    for (uint_t i = 0; i < sizeof(sectionNumbers) / sizeof(sectionNumbers[0]); ++i)
+    {
+        tsPacket->NextRound(EitActualSchTableId);
+        CPPUNIT_ASSERT(tsPacket->GetCodesSize(EitActualSchTableId, tsId) == sectionSize * sectionNumbers[i]);
+    }
+}
+
+/* split the payload of ts packets into sections, 0xff stuffing bytes are skipped. */
+static void SplitSections(const uchar_t *buffer, size_t size, list<vector<uchar_t>> &sections)
+{
+    vector<uchar_t> payload;
+    for (const uchar_t *ptr = buffer; ptr < buffer + size; ptr = ptr + TsPacketSize)
+    {
+        bool unitStart = ((ptr[1] & 0x40) != 0);
+        const uchar_t *start = ptr + sizeof(transport_packet) + (unitStart ? 1 : 0);
+        payload.insert(payload.end(), start, ptr + TsPacketSize);
+    }
+
+    for (size_t offset = 0; offset < payload.size();)
+    {
+        if (payload[offset] == 0xff)
+        {
+            ++offset;
+            continue;
+        }
+        size_t sectionSize = (((payload[offset + 1] & 0x0F) << 8) | payload[offset + 2]) + 3;
+        sections.push_back(vector<uchar_t>(payload.begin() + offset, payload.begin() + offset + sectionSize));
+        offset = offset + sectionSize;
+    }
+}
+
+void TransportPacket::TestTransportPacketSectionPacking()
+{
+    NetId     netId = 1;
+    BouquetId bouquetId = 2;
+    Version   version = 3;
+    TsId      tsId = 1;
+    OnId      onId = 0;
+
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+    static uchar_t buffer1[1024 * 16], buffer2[1024 * 16];
+    SiTableInterface *siTable;
+    siTable = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    tsPacket->AddSiTable(siTable);
+    for (uint_t i = 0; i < 200; ++i)
+    {
+        siTable->AddTs(i + 1, onId);
+    }
+    CPPUNIT_ASSERT(siTable->GetSecNumber(BatTableId, tsId) > 1);
+
+    size_t size1 = tsPacket->GetCodesSize(BatTableId, tsId);
+    CPPUNIT_ASSERT(size1 == tsPacket->MakeCodes(0, BatTableId, tsId, buffer1, sizeof(buffer1)));
+    CPPUNIT_ASSERT(tsPacket->GetSavedPacketNumber() == 0);
+
+    tsPacket->SetSectionPacking(true);
+    size_t size2 = tsPacket->GetCodesSize(BatTableId, tsId);
+    CPPUNIT_ASSERT(size2 < size1 && size2 % TsPacketSize == 0);
+    CPPUNIT_ASSERT(size2 == tsPacket->MakeCodes(1, BatTableId, tsId, buffer2, sizeof(buffer2)));
+    CPPUNIT_ASSERT(tsPacket->GetSavedPacketNumber() == (size1 - size2) / TsPacketSize);
+    CPPUNIT_ASSERT(tsPacket->GetPacketNumber() == (size1 + size2) / TsPacketSize);
+
+    /* continuity_counter increases by 1, a section starts after a non-zero pointer_field. */
+    bool shifted = false;
+    for (size_t i = 0; i < size2 / TsPacketSize; ++i)
+    {
+        uchar_t *ptr = buffer2 + TsPacketSize * i;
+        CPPUNIT_ASSERT(ptr[0] == 0x47 && (ptr[3] & 0x0F) == (i & 0x0F));
+        if ((ptr[1] & 0x40) != 0 && ptr[4] != 0)
+        {
+            shifted = true;
+        }
+    }
+    CPPUNIT_ASSERT(shifted);
+
+    /* same sections in same order. */
+    list<vector<uchar_t>> sections1, sections2;
+    SplitSections(buffer1, size1, sections1);
+    SplitSections(buffer2, size2, sections2);
+    CPPUNIT_ASSERT(sections1.size() == siTable->GetSecNumber(BatTableId, tsId));
+    CPPUNIT_ASSERT(sections1 == sections2);
+}
+
+void TransportPacket::TestTransportPacketTableIndex()
+{
+    NetId     netId = 1;
+    BouquetId bouquetId = 1;
+    Version   version = 1;
+    OnId      onId = 1;
+
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, BatPid));
+
+    /* bat is sent for every ts, sdt only for its own ts. */
+    SiTableInterface *bat = SiTableInterface::CreateBatInstance(BatTableId, bouquetId, version);
+    tsPacket->AddSiTable(bat);
+    SiTableInterface *sdt1 = SiTableInterface::CreateSdtInstance(SdtOtherTableId, 1, version, onId);
+    sdt1->AddService(1, 0, 1, 4, 0);
+    tsPacket->AddSiTable(sdt1);
+    SiTableInterface *sdt2 = SiTableInterface::CreateSdtInstance(SdtOtherTableId, 2, version, onId);
+    sdt2->AddService(1, 0, 1, 4, 0);
+    sdt2->AddService(2, 0, 1, 4, 0);
+    tsPacket->AddSiTable(sdt2);
+
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId, 1) == TsPacketSize);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(BatTableId, 3) == TsPacketSize);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(SdtOtherTableId, 1) == TsPacketSize);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(SdtOtherTableId, 3) == 0);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(SdtActualTableId, 1) == 0);
+
+    /* a new table of ts 1 replaces the live one, the old one is found and deleted first. */
+    SiTableInterface *sdt3 = SiTableInterface::CreateSdtInstance(SdtOtherTableId, 1, version, onId);
+    tsPacket->AddSiTable(sdt3);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(SdtOtherTableId, 1) == sdt1);
+    tsPacket->DelSiTable(SdtOtherTableId, 1);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(SdtOtherTableId, 1) == sdt3);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(SdtOtherTableId, 2) == sdt2);
+
+    static uchar_t buffer[TsPacketSize];
+    size_t size = tsPacket->MakeCodes(0, SdtOtherTableId, 1, buffer, sizeof(buffer));
+    CPPUNIT_ASSERT(size == TsPacketSize);
+    /* sdt3 has no service, section_length = 8 + crc. */
+    CPPUNIT_ASSERT(buffer[5] == SdtOtherTableId && buffer[7] == 12);
+
+    tsPacket->DelSiTable(SdtOtherTableId, 1);
+    CPPUNIT_ASSERT(tsPacket->FindSiTable(SdtOtherTableId, 1) == nullptr);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(SdtOtherTableId, 1) == 0);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(SdtOtherTableId, 2) == TsPacketSize);
+}
+
+void TransportPacket::TestTransportPacketSizeCache()
+{
+    NetId     netId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, SdtPid));
+    SiTableInterface *siTable = SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId);
+    siTable->AddService(1, 0, 1, 4, 0);
+    tsPacket->AddSiTable(siTable);
+
+    /* a table increases the change number given by its owner, sending doesn't change it. */
+    uint64_t changeNumber = 0;
+    auto_ptr<SiTableInterface> other(SiTableInterface::CreateSdtInstance(SdtActualTableId, tsId, version, onId));
+    other->SetChangeNumber(&changeNumber);
+    other->AddService(1, 0, 1, 4, 0);
+    CPPUNIT_ASSERT(changeNumber == 1);
+    static uchar_t buffer[TsPacketSize * 16];
+    CPPUNIT_ASSERT(other->MakeCodes(SdtActualTableId, tsId, buffer, sizeof(buffer), 0) != 0);
+    CPPUNIT_ASSERT(changeNumber == 1);
+    other->SetChangeNumber(nullptr);
+
+    size_t size = tsPacket->GetCodesSize(SdtActualTableId, tsId);
+    CPPUNIT_ASSERT(size == TsPacketSize);
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, SdtActualTableId, tsId, buffer, sizeof(buffer)) == size);
+    CPPUNIT_ASSERT(tsPacket->GetCodesSize(SdtActualTableId, tsId) == size);
+
+    /* a changed table increases the change number of its ts, the size is counted again. */
+    for (ServiceId serviceId = 2; serviceId < 60; ++serviceId)
+    {
+        siTable->AddService(serviceId, 0, 1, 4, 0);
+    }
+    size = tsPacket->GetCodesSize(SdtActualTableId, tsId);
+    CPPUNIT_ASSERT(size > TsPacketSize);
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(1, SdtActualTableId, tsId, buffer, sizeof(buffer)) == size);
+}
+
+void TransportPacket::TestTransportPacketSizeCacheSharedModel()
+{
+    NetId     netId = 1;
+    ServiceId serviceId = 1;
+    Version   version = 1;
+    TsId      tsId = 1;
+    OnId      onId = 1;
+
+    /* eit actual of the service is sent by the ts packet, eit other of the service (of
+       another network) shares the model.  event 1 is over.
+     */
+    time_t now = time(nullptr);
+    time_t startTimes[] = {now - 7200, now + 1800};
+    SiTableInterface *eits[2];
+    TableId tableIds[] = {EitActualSchTableId, EitOtherSchTableId};
+    for (uint_t i = 0; i < 2; ++i)
+    {
+        eits[i] = SiTableInterface::CreateEitInstance(tableIds[i], serviceId, version, tsId, onId);
+        for (EventId eventId = 1; eventId <= 2; ++eventId)
+        {
+            char startTime[32];
+            strftime(startTime, sizeof(startTime), "%Y-%m-%d %H:%M:%S", localtime(&startTimes[eventId - 1]));
+            eits[i]->AddEvent(eventId, startTime, 3600, 4, 1);
+            eits[i]->AddEventDescriptor(eventId, GetDescriptorString(200));
+        }
+        eits[i]->Seal();
+    }
+    auto_ptr<TransportPacketInterface> tsPacket(TransportPacketInterface::CreateInstance(netId, EitPid));
+    tsPacket->AddSiTable(eits[0]);
+    auto_ptr<SiTableInterface> eit2(eits[1]);
+    uint64_t changeNumber = 0;
+    eit2->SetChangeNumber(&changeNumber);
+
+    /* 2 events of 212 bytes in 1 section, 3 ts packets. */
+    size_t size = tsPacket->GetCodesSize(EitActualSchTableId, tsId);
+    CPPUNIT_ASSERT(size == TsPacketSize * 3);
+
+    /* the out of date event is removed through eit other, the model tells both tables, so
+       the eit actual in the ts packet is counted again without being asked.
+     */
+    eit2->RefreshCatch();
+    CPPUNIT_ASSERT(changeNumber != 0);
+    size = tsPacket->GetCodesSize(EitActualSchTableId, tsId);
+    CPPUNIT_ASSERT(size == TsPacketSize * 2);
+
+    static uchar_t buffer[TsPacketSize * 4];
+    CPPUNIT_ASSERT(tsPacket->MakeCodes(0, EitActualSchTableId, tsId, buffer, sizeof(buffer)) == size);
+    eit2->SetChangeNumber(nullptr);
+}
+
+/**********************class TransportPackets**********************/
+CPPUNIT_TEST_SUITE_REGISTRATION(TransportPackets);
+void TransportPackets::TestTransportPacketsBegin()
+{
+    auto_ptr<TransportPacketsInterface> tsPackets(TransportPacketsInterface::CreateInstance());
+    CPPUNIT_ASSERT(tsPackets->Begin() == tsPackets->End());
+
+    NetId     netId = 1;
+    BouquetId bouquetId = 2;
+    Version   version = 3;
+    
+    TransportPacketInterface *tsPacket = TransportPacketInterface::CreateInstance(netId, BatPid);
+    tsPackets->Add(tsPacket);
+    CPPUNIT_ASSERT(tsPackets->Begin() != tsPackets->End());
+    uint_t count = 0;
+    TransportPacketsInterface::iterator iter;
+    for (iter = tsPackets->Begin(); iter != tsPackets->End(); ++iter)
+    {
+        count++;
+    }
+    CPPUNIT_ASSERT(count == 1);
+
+    iter = tsPackets->Find(netId, BatPid);
+    CPPUNIT_ASSERT(iter != tsPackets->End());
+
+    iter = tsPackets->Find(netId + 1, BatPid);
+    CPPUNIT_ASSERT(iter == tsPackets->End());
+
+    iter = tsPackets->Find(netId, InvalidPid);
+    CPPUNIT_ASSERT(iter == tsPackets->End());
+}
+
 CxxEndNameSpace
\ No newline at end of file
@@ -1 +1 @@
-#define ExeVersion "694" 
+#define ExeVersion "694" 